@@ -0,0 +1,430 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                               *
+ * Copyright (c) 2015 The Regents of the University of California, Author: William Lenthe        *
+ *                                                                                               *
+ * This program is free software: you can redistribute it and/or modify it under the terms of    *
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either    *
+ * version 2 of the License, or (at your option) any later version.                              *
+ *                                                                                               *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;     *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.     *
+ * See the GNU Lesser General Public License for more details.                                   *
+ *                                                                                               *
+ * You should have received a copy of the GNU Lesser General Public License                      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.                         *
+ *                                                                                               *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "UnitTestSupport.hpp"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
+#include "UCSBUtilitiesTestFileLocations.h"
+
+class FindBoundaryAreasTest
+{
+
+public:
+  FindBoundaryAreasTest() = default;
+  ~FindBoundaryAreasTest() = default;
+
+  const QString k_FilterName = QString("FindBoundaryAreas");
+  const DataArrayPath k_FeatureFaceIdsPath = {"TriangleDataContainer", "FaceData", "FeatureFaceIds"};
+  const DataArrayPath k_FaceAreasPath = {"TriangleDataContainer", "FaceData", "FaceAreas"};
+  const DataArrayPath k_FaceValuesPath = {"TriangleDataContainer", "FaceData", "FaceValues"};
+  const DataArrayPath k_FaceFlagsPath = {"TriangleDataContainer", "FaceData", "FaceFlags"};
+  const DataArrayPath k_BoundaryAreasPath = {"TriangleDataContainer", "FaceFeatureData", "BoundaryAreas"};
+  const QString k_TriangleCountsName = QString("NumTriangles");
+
+  /**
+   * @brief Serial reference of the reductions of one face array (row major, one row of components per face feature)
+   */
+  struct Reference
+  {
+    std::vector<double> sums;
+    std::vector<double> minima;
+    std::vector<double> maxima;
+    std::vector<double> means;
+  };
+
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(k_FilterName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The FindBoundaryAreasTest Requires the use of the " << k_FilterName.toStdString() << " filter which is found in the UCSBUtilities Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Builds a rough height field of numCells x numCells quads (2 triangles each) with the triangle areas, random face
+   * feature ids in [1, numFeatures - 2] (so the first and last face features have no faces), a 3 component float face array
+   * and a 1 component int32 face array
+   */
+  DataContainerArray::Pointer CreateMesh(size_t numCells, size_t numFeatures)
+  {
+    std::mt19937_64 generator(12345);
+    std::uniform_real_distribution<float> heights(0.0f, 2.0f);
+    std::uniform_real_distribution<float> values(-5.0f, 5.0f);
+    std::uniform_int_distribution<int32_t> features(1, static_cast<int32_t>(numFeatures) - 2);
+    std::uniform_int_distribution<int32_t> flags(-100, 100);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer mesh = DataContainer::New(k_FeatureFaceIdsPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(mesh);
+
+    size_t numVertices = (numCells + 1) * (numCells + 1);
+    size_t numTriangles = 2 * numCells * numCells;
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(numVertices));
+    float* vertex = vertices->getPointer(0);
+    for(size_t y = 0; y <= numCells; y++)
+    {
+      for(size_t x = 0; x <= numCells; x++, vertex += 3)
+      {
+        vertex[0] = static_cast<float>(x);
+        vertex[1] = static_cast<float>(y);
+        vertex[2] = heights(generator);
+      }
+    }
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(static_cast<int64_t>(numTriangles), vertices, SIMPL::Geometry::TriangleGeometry, true);
+    MeshIndexType* triangle = triangles->getTriPointer(0);
+    for(size_t y = 0; y < numCells; y++)
+    {
+      for(size_t x = 0; x < numCells; x++, triangle += 6)
+      {
+        MeshIndexType corner = y * (numCells + 1) + x;
+        triangle[0] = corner;
+        triangle[1] = corner + 1;
+        triangle[2] = corner + numCells + 2;
+        triangle[3] = corner;
+        triangle[4] = corner + numCells + 2;
+        triangle[5] = corner + numCells + 1;
+      }
+    }
+    mesh->setGeometry(triangles);
+
+    std::vector<size_t> tDims(1, numTriangles);
+    AttributeMatrix::Pointer faceAttrMat = AttributeMatrix::New(tDims, k_FeatureFaceIdsPath.getAttributeMatrixName(), AttributeMatrix::Type::Face);
+    mesh->addOrReplaceAttributeMatrix(faceAttrMat);
+    std::vector<size_t> cDims(1, 1);
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(numTriangles, cDims, k_FeatureFaceIdsPath.getDataArrayName(), true);
+    DoubleArrayType::Pointer areas = DoubleArrayType::CreateArray(numTriangles, cDims, k_FaceAreasPath.getDataArrayName(), true);
+    Int32ArrayType::Pointer faceFlags = Int32ArrayType::CreateArray(numTriangles, cDims, k_FaceFlagsPath.getDataArrayName(), true);
+    cDims[0] = 3;
+    FloatArrayType::Pointer faceValues = FloatArrayType::CreateArray(numTriangles, cDims, k_FaceValuesPath.getDataArrayName(), true);
+    const float* vertexPtr = triangles->getVertexPointer(0);
+    const MeshIndexType* trianglePtr = triangles->getTriPointer(0);
+    for(size_t i = 0; i < numTriangles; i++)
+    {
+      ids->setValue(i, features(generator));
+      faceFlags->setValue(i, flags(generator));
+      for(size_t c = 0; c < 3; c++)
+      {
+        faceValues->setComponent(i, c, values(generator));
+      }
+
+      // half the norm of the cross product of two edges, in double precision
+      const float* a = vertexPtr + 3 * trianglePtr[3 * i];
+      const float* b = vertexPtr + 3 * trianglePtr[3 * i + 1];
+      const float* c = vertexPtr + 3 * trianglePtr[3 * i + 2];
+      double ab[3] = {static_cast<double>(b[0]) - a[0], static_cast<double>(b[1]) - a[1], static_cast<double>(b[2]) - a[2]};
+      double ac[3] = {static_cast<double>(c[0]) - a[0], static_cast<double>(c[1]) - a[1], static_cast<double>(c[2]) - a[2]};
+      double cross[3] = {ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0]};
+      areas->setValue(i, 0.5 * std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]));
+    }
+    faceAttrMat->insertOrAssign(ids);
+    faceAttrMat->insertOrAssign(areas);
+    faceAttrMat->insertOrAssign(faceFlags);
+    faceAttrMat->insertOrAssign(faceValues);
+
+    tDims[0] = numFeatures;
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tDims, k_BoundaryAreasPath.getAttributeMatrixName(), AttributeMatrix::Type::FaceFeature);
+    mesh->addOrReplaceAttributeMatrix(featureAttrMat);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Runs the filter on dca with every reduction of the face values and face flags
+   * @param areaSource Read the areas from the face areas array (0) or compute them from the triangle geometry (1)
+   */
+  void RunFilter(const DataContainerArray::Pointer& dca, int areaSource)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(areaSource);
+    DREAM3D_REQUIRE(filter->setProperty("AreaSource", var))
+    var.setValue(k_FaceAreasPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshTriangleAreasArrayPath", var))
+    var.setValue(k_FeatureFaceIdsPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFeatureFaceIdsArrayPath", var))
+    var.setValue(k_BoundaryAreasPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshBoundaryAreasArrayPath", var))
+    std::vector<DataArrayPath> selectedPaths = {k_FaceValuesPath, k_FaceFlagsPath};
+    var.setValue(selectedPaths);
+    DREAM3D_REQUIRE(filter->setProperty("SelectedFaceArrayPaths", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("ComputeSums", var))
+    DREAM3D_REQUIRE(filter->setProperty("ComputeMinima", var))
+    DREAM3D_REQUIRE(filter->setProperty("ComputeMaxima", var))
+    DREAM3D_REQUIRE(filter->setProperty("ComputeAreaWeightedMeans", var))
+    DREAM3D_REQUIRE(filter->setProperty("ComputeTriangleCounts", var))
+    var.setValue(k_TriangleCountsName);
+    DREAM3D_REQUIRE(filter->setProperty("TriangleCountsArrayName", var))
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Reduces a face array over the faces of each face feature with a plain serial loop in face order
+   */
+  template <typename T>
+  Reference ReduceSerially(const DataContainerArray::Pointer& dca, const DataArrayPath& path, size_t numFeatures)
+  {
+    // the face values may have any number of components
+    typename DataArray<T>::Pointer values = dca->getAttributeMatrix(path)->getAttributeArrayAs<DataArray<T>>(path.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(values.get())
+    Int32ArrayType::Pointer ids = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FeatureFaceIdsPath, {1});
+    DoubleArrayType::Pointer areas = dca->getPrereqArrayFromPath<DoubleArrayType>(nullptr, k_FaceAreasPath, {1});
+    size_t numComponents = values->getNumberOfComponents();
+
+    Reference reference;
+    reference.sums.assign(numFeatures * numComponents, 0.0);
+    reference.minima.assign(numFeatures * numComponents, std::numeric_limits<double>::max());
+    reference.maxima.assign(numFeatures * numComponents, std::numeric_limits<double>::lowest());
+    reference.means.assign(numFeatures * numComponents, 0.0);
+    std::vector<double> featureAreas(numFeatures, 0.0);
+    for(size_t i = 0; i < ids->getNumberOfTuples(); i++)
+    {
+      size_t feature = static_cast<size_t>(ids->getValue(i));
+      featureAreas[feature] += areas->getValue(i);
+      for(size_t c = 0; c < numComponents; c++)
+      {
+        double value = static_cast<double>(values->getComponent(i, c));
+        size_t j = feature * numComponents + c;
+        reference.sums[j] += value;
+        reference.minima[j] = std::min(reference.minima[j], value);
+        reference.maxima[j] = std::max(reference.maxima[j], value);
+        reference.means[j] += areas->getValue(i) * value;
+      }
+    }
+    for(size_t j = 0; j < reference.sums.size(); j++)
+    {
+      double area = featureAreas[j / numComponents];
+      reference.means[j] = area > 0.0 ? reference.means[j] / area : 0.0;
+      if(std::numeric_limits<double>::max() == reference.minima[j])
+      {
+        reference.minima[j] = 0.0;
+        reference.maxima[j] = 0.0;
+      }
+    }
+    return reference;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Requires the face feature array named after the face array with suffix to equal expected
+   */
+  void RequireReduction(const DataContainerArray::Pointer& dca, const DataArrayPath& path, const QString& suffix, const std::vector<double>& expected)
+  {
+    DataArrayPath reducedPath(k_BoundaryAreasPath.getDataContainerName(), k_BoundaryAreasPath.getAttributeMatrixName(), path.getDataArrayName() + suffix);
+    DoubleArrayType::Pointer reduced = dca->getAttributeMatrix(reducedPath)->getAttributeArrayAs<DoubleArrayType>(reducedPath.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(reduced.get())
+    DREAM3D_REQUIRE_EQUAL(reduced->getSize(), expected.size())
+    for(size_t j = 0; j < expected.size(); j++)
+    {
+      DREAM3D_REQUIRE_EQUAL(reduced->getValue(j), expected[j])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Checks every output of the filter against serial reductions of the face arrays
+   */
+  void RequireSerialResults(const DataContainerArray::Pointer& dca, size_t numFeatures)
+  {
+    Int32ArrayType::Pointer ids = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FeatureFaceIdsPath, {1});
+    DoubleArrayType::Pointer areas = dca->getPrereqArrayFromPath<DoubleArrayType>(nullptr, k_FaceAreasPath, {1});
+    std::vector<double> featureAreas(numFeatures, 0.0);
+    std::vector<int32_t> counts(numFeatures, 0);
+    for(size_t i = 0; i < ids->getNumberOfTuples(); i++)
+    {
+      featureAreas[ids->getValue(i)] += areas->getValue(i);
+      counts[ids->getValue(i)]++;
+    }
+
+    DoubleArrayType::Pointer boundaryAreas = dca->getPrereqArrayFromPath<DoubleArrayType>(nullptr, k_BoundaryAreasPath, {1});
+    DataArrayPath countsPath(k_BoundaryAreasPath.getDataContainerName(), k_BoundaryAreasPath.getAttributeMatrixName(), k_TriangleCountsName);
+    Int32ArrayType::Pointer triangleCounts = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, countsPath, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(boundaryAreas.get())
+    DREAM3D_REQUIRE_VALID_POINTER(triangleCounts.get())
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      DREAM3D_REQUIRE_EQUAL(boundaryAreas->getValue(f), featureAreas[f])
+      DREAM3D_REQUIRE_EQUAL(triangleCounts->getValue(f), counts[f])
+    }
+
+    // the first and last face features have no faces, so every reduction of them must be 0
+    DREAM3D_REQUIRE_EQUAL(counts.front(), 0)
+    DREAM3D_REQUIRE_EQUAL(counts.back(), 0)
+
+    Reference values = ReduceSerially<float>(dca, k_FaceValuesPath, numFeatures);
+    RequireReduction(dca, k_FaceValuesPath, "Sum", values.sums);
+    RequireReduction(dca, k_FaceValuesPath, "Min", values.minima);
+    RequireReduction(dca, k_FaceValuesPath, "Max", values.maxima);
+    RequireReduction(dca, k_FaceValuesPath, "AreaWeightedMean", values.means);
+    Reference flags = ReduceSerially<int32_t>(dca, k_FaceFlagsPath, numFeatures);
+    RequireReduction(dca, k_FaceFlagsPath, "Sum", flags.sums);
+    RequireReduction(dca, k_FaceFlagsPath, "Min", flags.minima);
+    RequireReduction(dca, k_FaceFlagsPath, "Max", flags.maxima);
+    RequireReduction(dca, k_FaceFlagsPath, "AreaWeightedMean", flags.means);
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestReductions()
+  {
+    // few face features: every chunk reduces into its own rows (a single chunk here, so in the serial order)
+    DataContainerArray::Pointer dca = CreateMesh(40, 50);
+    RunFilter(dca, 0);
+    RequireSerialResults(dca, 50);
+
+    // many face features: the faces are bucketed by blocks of face features and reduced in the serial order
+    dca = CreateMesh(100, 15000);
+    RunFilter(dca, 0);
+    RequireSerialResults(dca, 15000);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Concatenates every face feature output of the filter (boundary areas, triangle counts and the reductions)
+   */
+  std::vector<double> GatherOutputs(const DataContainerArray::Pointer& dca)
+  {
+    AttributeMatrix::Pointer featureAttrMat = dca->getAttributeMatrix(k_BoundaryAreasPath);
+    std::vector<double> outputs;
+    DoubleArrayType::Pointer boundaryAreas = featureAttrMat->getAttributeArrayAs<DoubleArrayType>(k_BoundaryAreasPath.getDataArrayName());
+    Int32ArrayType::Pointer triangleCounts = featureAttrMat->getAttributeArrayAs<Int32ArrayType>(k_TriangleCountsName);
+    DREAM3D_REQUIRE_VALID_POINTER(boundaryAreas.get())
+    DREAM3D_REQUIRE_VALID_POINTER(triangleCounts.get())
+    outputs.insert(outputs.end(), boundaryAreas->begin(), boundaryAreas->end());
+    outputs.insert(outputs.end(), triangleCounts->begin(), triangleCounts->end());
+    for(const DataArrayPath& path : {k_FaceValuesPath, k_FaceFlagsPath})
+    {
+      for(const QString& suffix : {QString("Sum"), QString("Min"), QString("Max"), QString("AreaWeightedMean")})
+      {
+        DoubleArrayType::Pointer reduced = featureAttrMat->getAttributeArrayAs<DoubleArrayType>(path.getDataArrayName() + suffix);
+        DREAM3D_REQUIRE_VALID_POINTER(reduced.get())
+        outputs.insert(outputs.end(), reduced->begin(), reduced->end());
+      }
+    }
+    return outputs;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestTriangleGeometryAreas()
+  {
+    // the areas computed from the triangle geometry must reproduce the results of the (identically computed) areas array
+    for(size_t numFeatures : {size_t(50), size_t(15000)})
+    {
+      DataContainerArray::Pointer arrayDca = CreateMesh(100, numFeatures);
+      RunFilter(arrayDca, 0);
+      DataContainerArray::Pointer geometryDca = CreateMesh(100, numFeatures);
+      RunFilter(geometryDca, 1);
+      std::vector<double> arrayOutputs = GatherOutputs(arrayDca);
+      std::vector<double> geometryOutputs = GatherOutputs(geometryDca);
+      DREAM3D_REQUIRE_EQUAL(geometryOutputs.size(), arrayOutputs.size())
+      for(size_t i = 0; i < arrayOutputs.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(geometryOutputs[i], arrayOutputs[i])
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestThreadCountIndependence()
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // meshes of several chunks of faces with few (dense rows) and many (bucketed faces) face features must give bit
+    // identical results whatever the number of threads
+    for(size_t numFeatures : {size_t(300), size_t(400000)})
+    {
+      std::vector<double> reference;
+      for(int numThreads : {1, 2, 3, 8})
+      {
+        DataContainerArray::Pointer dca = CreateMesh(1200, numFeatures);
+        tbb::task_arena arena(numThreads);
+        arena.execute([&] { RunFilter(dca, 0); });
+        std::vector<double> outputs = GatherOutputs(dca);
+        if(reference.empty())
+        {
+          reference = outputs;
+        }
+        DREAM3D_REQUIRE_EQUAL(outputs.size(), reference.size())
+        for(size_t i = 0; i < outputs.size(); i++)
+        {
+          DREAM3D_REQUIRE_EQUAL(outputs[i], reference[i])
+        }
+      }
+    }
+#endif
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability())
+    DREAM3D_REGISTER_TEST(TestReductions())
+    DREAM3D_REGISTER_TEST(TestTriangleGeometryAreas())
+    DREAM3D_REGISTER_TEST(TestThreadCountIndependence())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  FindBoundaryAreasTest(const FindBoundaryAreasTest&) = delete;            // Copy Constructor Not Implemented
+  FindBoundaryAreasTest(FindBoundaryAreasTest&&) = delete;                 // Move Constructor Not Implemented
+  FindBoundaryAreasTest& operator=(const FindBoundaryAreasTest&) = delete; // Copy Assignment Not Implemented
+  FindBoundaryAreasTest& operator=(FindBoundaryAreasTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,641 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                               *
+ * Copyright (c) 2015 The Regents of the University of California, Author: William Lenthe        *
+ *                                                                                               *
+ * This program is free software: you can redistribute it and/or modify it under the terms of    *
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either    *
+ * version 2 of the License, or (at your option) any later version.                              *
+ *                                                                                               *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;     *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.     *
+ * See the GNU Lesser General Public License for more details.                                   *
+ *                                                                                               *
+ * You should have received a copy of the GNU Lesser General Public License                      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.                         *
+ *                                                                                               *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include "UCSBUtilitiesFilters/FindDirectionalModuli.h"
+#include "UCSBUtilitiesTestFileLocations.h"
+
+class FindDirectionalModuliTest
+{
+  using Tensor = std::array<double, 81>;
+  using Compliances = std::array<double, 36>;
+
+public:
+  FindDirectionalModuliTest() = default;
+  ~FindDirectionalModuliTest() = default;
+
+  const QString k_FilterName = QString("FindDirectionalModuli");
+  const DataArrayPath k_FeaturePhasesPath = {"DataContainer", "FeatureData", "Phases"};
+  const DataArrayPath k_AvgQuatsPath = {"DataContainer", "FeatureData", "AvgQuats"};
+  const DataArrayPath k_CellPhasesPath = {"DataContainer", "CellData", "Phases"};
+  const DataArrayPath k_CellQuatsPath = {"DataContainer", "CellData", "Quats"};
+  const DataArrayPath k_CrystalStructuresPath = {"DataContainer", "EnsembleData", "CrystalStructures"};
+  const DataArrayPath k_CrystalCompliancesPath = {"DataContainer", "EnsembleData", "CrystalCompliances"};
+  const DataArrayPath k_LoadingDirectionsPath = {"DataContainer", "LoadingData", "LoadingDirections"};
+  const size_t k_FeaturesPerPhase = 6;
+  const size_t k_CellsPerFeature = 2;
+
+  // (not normalized) loading directions, including the two that are special cased (+/-100)
+  const std::vector<std::array<float, 3>> k_LoadingDirections = {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 2.0f, 3.0f}, {-1.0f, 0.0f, 0.0f}, {0.3f, -0.2f, 0.9f}};
+  const std::array<float, 3> k_TransverseDirection = {0.0f, 1.0f, 1.0f};
+  const QStringList k_OutputNames = {"DirectionalModuli", "SampleCompliances", "ExtremalModuli", "ExtremalDirections", "AnisotropyRatios", "ShearModuli", "PoissonRatios"};
+
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(k_FilterName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The FindDirectionalModuliTest Requires the use of the " << k_FilterName.toStdString() << " filter which is found in the UCSBUtilities Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Builds a full 6x6 compliance matrix from its 21 independent components (upper triangle, row major)
+   */
+  Compliances Symmetric(const std::array<double, 21>& upper)
+  {
+    Compliances s = {};
+    size_t k = 0;
+    for(size_t i = 0; i < 6; i++)
+    {
+      for(size_t j = i; j < 6; j++)
+      {
+        s[6 * i + j] = upper[k];
+        s[6 * j + i] = upper[k];
+        k++;
+      }
+    }
+    return s;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Single crystal compliances (1/GPa) of each phase: unknown, cubic (copper), hexagonal (titanium, S66 = 2 (S11 - S12)),
+   * orthorhombic (olivine like) and triclinic (no zero terms)
+   */
+  std::vector<std::pair<uint32_t, Compliances>> Phases()
+  {
+    std::vector<std::pair<uint32_t, Compliances>> phases;
+    phases.emplace_back(EbsdLib::CrystalStructure::UnknownCrystalStructure, Compliances());
+    phases.emplace_back(EbsdLib::CrystalStructure::Cubic_High,
+                        Symmetric({0.0150, -0.0063, -0.0063, 0.0, 0.0, 0.0, 0.0150, -0.0063, 0.0, 0.0, 0.0, 0.0150, 0.0, 0.0, 0.0, 0.0133, 0.0, 0.0, 0.0133, 0.0, 0.0133}));
+    phases.emplace_back(EbsdLib::CrystalStructure::Hexagonal_High, Symmetric({0.00958, -0.00462, -0.00189, 0.0, 0.0, 0.0, 0.00958, -0.00189, 0.0, 0.0, 0.0, 0.00698, 0.0, 0.0, 0.0, 0.02141,
+                                                                               0.0, 0.0, 0.02141, 0.0, 2.0 * (0.00958 + 0.00462)}));
+    phases.emplace_back(EbsdLib::CrystalStructure::OrthoRhombic,
+                        Symmetric({0.00313, -0.00073, -0.00064, 0.0, 0.0, 0.0, 0.00502, -0.00123, 0.0, 0.0, 0.0, 0.00431, 0.0, 0.0, 0.0, 0.0149, 0.0, 0.0, 0.0127, 0.0, 0.0128}));
+    phases.emplace_back(EbsdLib::CrystalStructure::Triclinic, Symmetric({0.0120, -0.0035, -0.0028, 0.0011, -0.0006, 0.0009, 0.0095, -0.0031, -0.0008, 0.0013, -0.0005, 0.0108, 0.0007, 0.0010,
+                                                                          -0.0012, 0.0260, 0.0021, -0.0017, 0.0310, 0.0014, 0.0285}));
+    return phases;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Fills a phase and orientation array with numTuples random orientations, cycling through the phases (tuple 0 is
+   * always the reserved phase 0)
+   */
+  void FillOrientations(std::mt19937_64& generator, size_t numPhases, Int32ArrayType& phases, FloatArrayType& quats)
+  {
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+    for(size_t i = 0; i < phases.getNumberOfTuples(); i++)
+    {
+      phases.setValue(i, static_cast<int32_t>(i % numPhases));
+      std::array<float, 4> q;
+      float norm = 0.0f;
+      for(float& component : q)
+      {
+        component = distribution(generator);
+        norm += component * component;
+      }
+      norm = std::sqrt(norm);
+      for(size_t j = 0; j < 4; j++)
+      {
+        quats.setComponent(i, j, q[j] / norm);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Builds the ensemble, feature, cell and loading direction data
+   */
+  DataContainerArray::Pointer CreateDataContainerArray()
+  {
+    std::mt19937_64 generator(12345);
+    std::vector<std::pair<uint32_t, Compliances>> phaseData = Phases();
+    size_t numPhases = phaseData.size();
+    size_t numFeatures = 1 + (numPhases - 1) * k_FeaturesPerPhase;
+    size_t numCells = numFeatures * k_CellsPerFeature;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer volume = DataContainer::New(k_AvgQuatsPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(volume);
+
+    std::vector<size_t> tDims(1, numPhases);
+    AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(tDims, k_CrystalStructuresPath.getAttributeMatrixName(), AttributeMatrix::Type::CellEnsemble);
+    volume->addOrReplaceAttributeMatrix(ensembleAttrMat);
+    std::vector<size_t> cDims(1, 1);
+    UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(numPhases, cDims, k_CrystalStructuresPath.getDataArrayName(), true);
+    std::vector<size_t> complianceDims(2, 6);
+    FloatArrayType::Pointer compliances = FloatArrayType::CreateArray(numPhases, complianceDims, k_CrystalCompliancesPath.getDataArrayName(), true);
+    for(size_t p = 0; p < numPhases; p++)
+    {
+      crystalStructures->setValue(p, phaseData[p].first);
+      for(size_t k = 0; k < 36; k++)
+      {
+        compliances->setComponent(p, k, static_cast<float>(phaseData[p].second[k]));
+      }
+    }
+    ensembleAttrMat->insertOrAssign(crystalStructures);
+    ensembleAttrMat->insertOrAssign(compliances);
+
+    tDims[0] = numFeatures;
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tDims, k_AvgQuatsPath.getAttributeMatrixName(), AttributeMatrix::Type::CellFeature);
+    volume->addOrReplaceAttributeMatrix(featureAttrMat);
+    Int32ArrayType::Pointer featurePhases = Int32ArrayType::CreateArray(numFeatures, cDims, k_FeaturePhasesPath.getDataArrayName(), true);
+    cDims[0] = 4;
+    FloatArrayType::Pointer avgQuats = FloatArrayType::CreateArray(numFeatures, cDims, k_AvgQuatsPath.getDataArrayName(), true);
+    FillOrientations(generator, numPhases, *featurePhases, *avgQuats);
+    featureAttrMat->insertOrAssign(featurePhases);
+    featureAttrMat->insertOrAssign(avgQuats);
+
+    tDims[0] = numCells;
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, k_CellQuatsPath.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    volume->addOrReplaceAttributeMatrix(cellAttrMat);
+    cDims[0] = 1;
+    Int32ArrayType::Pointer cellPhases = Int32ArrayType::CreateArray(numCells, cDims, k_CellPhasesPath.getDataArrayName(), true);
+    cDims[0] = 4;
+    FloatArrayType::Pointer cellQuats = FloatArrayType::CreateArray(numCells, cDims, k_CellQuatsPath.getDataArrayName(), true);
+    FillOrientations(generator, numPhases, *cellPhases, *cellQuats);
+    cellAttrMat->insertOrAssign(cellPhases);
+    cellAttrMat->insertOrAssign(cellQuats);
+
+    tDims[0] = k_LoadingDirections.size();
+    AttributeMatrix::Pointer loadingAttrMat = AttributeMatrix::New(tDims, k_LoadingDirectionsPath.getAttributeMatrixName(), AttributeMatrix::Type::Generic);
+    volume->addOrReplaceAttributeMatrix(loadingAttrMat);
+    cDims[0] = 3;
+    FloatArrayType::Pointer loadingDirections = FloatArrayType::CreateArray(k_LoadingDirections.size(), cDims, k_LoadingDirectionsPath.getDataArrayName(), true);
+    for(size_t d = 0; d < k_LoadingDirections.size(); d++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        loadingDirections->setComponent(d, j, k_LoadingDirections[d][j]);
+      }
+    }
+    loadingAttrMat->insertOrAssign(loadingDirections);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Creates the filter with every output enabled. Element level outputs are prefixed with "Cell" so that the test
+   * can tell which names were used.
+   */
+  AbstractFilter::Pointer CreateFilter(const DataContainerArray::Pointer& dca, bool elementLevel)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+    QVariant var;
+    var.setValue(elementLevel ? 1 : 0);
+    DREAM3D_REQUIRE(filter->setProperty("OrientationLevel", var))
+    var.setValue(k_FeaturePhasesPath);
+    DREAM3D_REQUIRE(filter->setProperty("FeaturePhasesArrayPath", var))
+    var.setValue(k_AvgQuatsPath);
+    DREAM3D_REQUIRE(filter->setProperty("AvgQuatsArrayPath", var))
+    var.setValue(k_CellPhasesPath);
+    DREAM3D_REQUIRE(filter->setProperty("CellPhasesArrayPath", var))
+    var.setValue(k_CellQuatsPath);
+    DREAM3D_REQUIRE(filter->setProperty("CellQuatsArrayPath", var))
+    var.setValue(k_CrystalStructuresPath);
+    DREAM3D_REQUIRE(filter->setProperty("CrystalStructuresArrayPath", var))
+    var.setValue(k_CrystalCompliancesPath);
+    DREAM3D_REQUIRE(filter->setProperty("CrystalCompliancesArrayPath", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("UseLoadingDirectionsArray", var))
+    var.setValue(k_LoadingDirectionsPath);
+    DREAM3D_REQUIRE(filter->setProperty("LoadingDirectionsArrayPath", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("ComputeSampleCompliances", var))
+    DREAM3D_REQUIRE(filter->setProperty("FindExtremalModuli", var))
+    DREAM3D_REQUIRE(filter->setProperty("ComputeShearAndPoisson", var))
+    var.setValue(FloatVec3Type(k_TransverseDirection[0], k_TransverseDirection[1], k_TransverseDirection[2]));
+    DREAM3D_REQUIRE(filter->setProperty("TransverseDirection", var))
+    for(const QString& name : k_OutputNames)
+    {
+      var.setValue(QString("Cell") + name);
+      DREAM3D_REQUIRE(filter->setProperty(QString("Cell%1ArrayName").arg(name).toLatin1().constData(), var))
+    }
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Expands a 6x6 (engineering strain) Voigt compliance matrix into the 4th order compliance tensor
+   */
+  Tensor ToTensor(const Compliances& s)
+  {
+    const size_t voigt[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+    Tensor t;
+    for(size_t i = 0; i < 3; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        for(size_t k = 0; k < 3; k++)
+        {
+          for(size_t l = 0; l < 3; l++)
+          {
+            size_t row = voigt[i][j];
+            size_t col = voigt[k][l];
+            double factor = (row < 3 ? 1.0 : 0.5) * (col < 3 ? 1.0 : 0.5);
+            t[27 * i + 9 * j + 3 * k + l] = factor * s[6 * row + col];
+          }
+        }
+      }
+    }
+    return t;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Rotates a crystal frame compliance tensor into the sample frame of an orientation with the full tensor rotation
+   * S'_ijkl = g_ip g_jq g_kr g_ls S_pqrs (the rows of the orientation matrix g are the sample axes in the crystal frame)
+   */
+  Tensor RotateTensor(const Tensor& s, const float* quat)
+  {
+    double x = quat[0];
+    double y = quat[1];
+    double z = quat[2];
+    double w = quat[3];
+    const double g[3][3] = {{1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y - z * w), 2.0 * (x * z + y * w)},
+                            {2.0 * (x * y + z * w), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z - x * w)},
+                            {2.0 * (x * z - y * w), 2.0 * (y * z + x * w), 1.0 - 2.0 * (x * x + y * y)}};
+
+    // rotate one index at a time
+    const size_t strides[4] = {27, 9, 3, 1};
+    Tensor rotated = s;
+    for(size_t index = 0; index < 4; index++)
+    {
+      Tensor previous = rotated;
+      for(size_t n = 0; n < 81; n++)
+      {
+        size_t value = (n / strides[index]) % 3;
+        size_t base = n - value * strides[index];
+        rotated[n] = g[value][0] * previous[base] + g[value][1] * previous[base + strides[index]] + g[value][2] * previous[base + 2 * strides[index]];
+      }
+    }
+    return rotated;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Contracts a compliance tensor with 4 vectors (a_i b_j c_k d_l S_ijkl)
+   */
+  double Contract(const Tensor& s, const std::array<double, 3>& a, const std::array<double, 3>& b, const std::array<double, 3>& c, const std::array<double, 3>& d)
+  {
+    double sum = 0.0;
+    for(size_t i = 0; i < 3; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        for(size_t k = 0; k < 3; k++)
+        {
+          for(size_t l = 0; l < 3; l++)
+          {
+            sum += a[i] * b[j] * c[k] * d[l] * s[27 * i + 9 * j + 3 * k + l];
+          }
+        }
+      }
+    }
+    return sum;
+  }
+
+  // -----------------------------------------------------------------------------
+  std::array<double, 3> Normalize(const std::array<double, 3>& v)
+  {
+    double norm = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    return {v[0] / norm, v[1] / norm, v[2] / norm};
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Smallest and largest modulus of a crystal over a 1 degree grid of the upper hemisphere
+   */
+  std::pair<double, double> ScanModuli(const Tensor& s)
+  {
+    std::pair<double, double> extrema(std::numeric_limits<double>::max(), 0.0);
+    for(size_t polar = 0; polar <= 90; polar++)
+    {
+      for(size_t azimuth = 0; azimuth < 360; azimuth++)
+      {
+        double theta = static_cast<double>(polar) * M_PI / 180.0;
+        double phi = static_cast<double>(azimuth) * M_PI / 180.0;
+        std::array<double, 3> d = {std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta)};
+        double modulus = 1.0 / Contract(s, d, d, d, d);
+        extrema.first = std::min(extrema.first, modulus);
+        extrema.second = std::max(extrema.second, modulus);
+      }
+    }
+    return extrema;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Checks every output of the tuples in the attribute matrix of phasesPath against the full tensor rotation of
+   * the compliances: the moduli, shear moduli and Poisson's ratios (from the per Laue class closed forms) along each
+   * loading direction, the sample compliances and the extremal moduli / directions / ratios
+   */
+  void CheckOutputs(const DataContainerArray::Pointer& dca, const DataArrayPath& phasesPath, const DataArrayPath& quatsPath, const QString& prefix)
+  {
+    std::vector<std::pair<uint32_t, Compliances>> phaseData = Phases();
+    std::vector<Tensor> crystalTensors(phaseData.size());
+    std::vector<std::pair<double, double>> scans(phaseData.size());
+    for(size_t p = 1; p < phaseData.size(); p++)
+    {
+      crystalTensors[p] = ToTensor(phaseData[p].second);
+      scans[p] = ScanModuli(crystalTensors[p]);
+    }
+
+    AttributeMatrix::Pointer attrMat = dca->getAttributeMatrix(phasesPath);
+    DREAM3D_REQUIRE_VALID_POINTER(attrMat.get())
+    Int32ArrayType::Pointer phases = attrMat->getAttributeArrayAs<Int32ArrayType>(phasesPath.getDataArrayName());
+    FloatArrayType::Pointer quats = attrMat->getAttributeArrayAs<FloatArrayType>(quatsPath.getDataArrayName());
+    FloatArrayType::Pointer moduli = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "DirectionalModuli");
+    FloatArrayType::Pointer sampleCompliances = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "SampleCompliances");
+    FloatArrayType::Pointer extremalModuli = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "ExtremalModuli");
+    FloatArrayType::Pointer extremalDirections = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "ExtremalDirections");
+    FloatArrayType::Pointer anisotropyRatios = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "AnisotropyRatios");
+    FloatArrayType::Pointer shearModuli = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "ShearModuli");
+    FloatArrayType::Pointer poissonRatios = attrMat->getAttributeArrayAs<FloatArrayType>(prefix + "PoissonRatios");
+    for(const FloatArrayType::Pointer& output : {moduli, sampleCompliances, extremalModuli, extremalDirections, anisotropyRatios, shearModuli, poissonRatios})
+    {
+      DREAM3D_REQUIRE_VALID_POINTER(output.get())
+    }
+    size_t numDirections = k_LoadingDirections.size();
+    DREAM3D_REQUIRE_EQUAL(moduli->getNumberOfComponents(), numDirections)
+    DREAM3D_REQUIRE_EQUAL(sampleCompliances->getNumberOfComponents(), 21)
+    DREAM3D_REQUIRE_EQUAL(extremalModuli->getNumberOfComponents(), 2)
+    DREAM3D_REQUIRE_EQUAL(extremalDirections->getNumberOfComponents(), 6)
+    DREAM3D_REQUIRE_EQUAL(anisotropyRatios->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(shearModuli->getNumberOfComponents(), numDirections)
+    DREAM3D_REQUIRE_EQUAL(poissonRatios->getNumberOfComponents(), numDirections)
+
+    // loading directions and the transverse direction made perpendicular to each of them
+    std::vector<std::array<double, 3>> loading(numDirections);
+    std::vector<std::array<double, 3>> transverse(numDirections);
+    for(size_t d = 0; d < numDirections; d++)
+    {
+      loading[d] = Normalize({k_LoadingDirections[d][0], k_LoadingDirections[d][1], k_LoadingDirections[d][2]});
+      std::array<double, 3> t = Normalize({k_TransverseDirection[0], k_TransverseDirection[1], k_TransverseDirection[2]});
+      double projection = t[0] * loading[d][0] + t[1] * loading[d][1] + t[2] * loading[d][2];
+      transverse[d] = Normalize({t[0] - projection * loading[d][0], t[1] - projection * loading[d][1], t[2] - projection * loading[d][2]});
+    }
+
+    // Voigt order 11, 22, 33, 23, 13, 12
+    const size_t voigt[6][2] = {{0, 0}, {1, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
+    const double k_ComplianceTolerance = 1.0E-5 * 0.031;
+    for(size_t i = 0; i < phases->getNumberOfTuples(); i++)
+    {
+      int32_t phase = phases->getValue(i);
+      if(EbsdLib::CrystalStructure::UnknownCrystalStructure == phaseData[phase].first)
+      {
+        // unknown crystal structures are left at 0
+        for(const FloatArrayType::Pointer& output : {moduli, sampleCompliances, extremalModuli, extremalDirections, anisotropyRatios, shearModuli, poissonRatios})
+        {
+          for(size_t k = 0; k < output->getNumberOfComponents(); k++)
+          {
+            DREAM3D_REQUIRE_EQUAL(output->getComponent(i, k), 0.0f)
+          }
+        }
+        continue;
+      }
+
+      Tensor s = RotateTensor(crystalTensors[phase], quats->getTuplePointer(i));
+
+      // sample compliances (upper triangle of the engineering strain Voigt matrix)
+      size_t component = 0;
+      for(size_t row = 0; row < 6; row++)
+      {
+        for(size_t col = row; col < 6; col++)
+        {
+          double factor = (row < 3 ? 1.0 : 2.0) * (col < 3 ? 1.0 : 2.0);
+          double expected = factor * s[27 * voigt[row][0] + 9 * voigt[row][1] + 3 * voigt[col][0] + voigt[col][1]];
+          DREAM3D_REQUIRED(std::fabs(sampleCompliances->getComponent(i, component) - expected), <=, k_ComplianceTolerance)
+          component++;
+        }
+      }
+
+      // moduli along each loading direction (1 / s'11), shear moduli (1 / s'66) and Poisson's ratios (-s'12 / s'11) in
+      // the loading / transverse frame
+      for(size_t d = 0; d < numDirections; d++)
+      {
+        const std::array<double, 3>& l = loading[d];
+        const std::array<double, 3>& t = transverse[d];
+        double s11 = Contract(s, l, l, l, l);
+        double modulus = 1.0 / s11;
+        double shearModulus = 1.0 / (4.0 * Contract(s, l, t, l, t));
+        double poissonRatio = -Contract(s, l, l, t, t) / s11;
+        DREAM3D_REQUIRED(std::fabs(moduli->getComponent(i, d) - modulus), <=, 1.0E-4 * modulus)
+        DREAM3D_REQUIRED(std::fabs(shearModuli->getComponent(i, d) - shearModulus), <=, 1.0E-4 * shearModulus)
+        DREAM3D_REQUIRED(std::fabs(poissonRatios->getComponent(i, d) - poissonRatio), <=, 1.0E-4)
+      }
+
+      // extremal moduli bound the scan (and are close to its extremes), the ratio is max / min and the sample frame
+      // directions are unit length directions with those moduli
+      float minModulus = extremalModuli->getComponent(i, 0);
+      float maxModulus = extremalModuli->getComponent(i, 1);
+      DREAM3D_REQUIRED(minModulus, <=, scans[phase].first * (1.0 + 1.0E-4))
+      DREAM3D_REQUIRED(minModulus, >=, scans[phase].first * (1.0 - 1.0E-3))
+      DREAM3D_REQUIRED(maxModulus, >=, scans[phase].second * (1.0 - 1.0E-4))
+      DREAM3D_REQUIRED(maxModulus, <=, scans[phase].second * (1.0 + 1.0E-3))
+      DREAM3D_REQUIRED(std::fabs(anisotropyRatios->getValue(i) - maxModulus / minModulus), <=, 1.0E-6 * maxModulus / minModulus)
+      for(size_t d = 0; d < numDirections; d++)
+      {
+        DREAM3D_REQUIRED(moduli->getComponent(i, d), >=, minModulus * (1.0 - 1.0E-4))
+        DREAM3D_REQUIRED(moduli->getComponent(i, d), <=, maxModulus * (1.0 + 1.0E-4))
+      }
+      for(size_t extremum = 0; extremum < 2; extremum++)
+      {
+        std::array<double, 3> direction;
+        for(size_t j = 0; j < 3; j++)
+        {
+          direction[j] = extremalDirections->getComponent(i, 3 * extremum + j);
+        }
+        double length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+        DREAM3D_REQUIRED(std::fabs(length - 1.0), <=, 1.0E-5)
+        double expected = extremalModuli->getComponent(i, extremum);
+        double modulus = 1.0 / Contract(s, direction, direction, direction, direction);
+        DREAM3D_REQUIRED(std::fabs(modulus - expected), <=, 1.0E-4 * expected)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFeatureLevel()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    AbstractFilter::Pointer filter = CreateFilter(dca, false);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    CheckOutputs(dca, k_FeaturePhasesPath, k_AvgQuatsPath, "");
+
+    // nothing is written to the cell data
+    AttributeMatrix::Pointer cellAttrMat = dca->getAttributeMatrix(k_CellPhasesPath);
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumAttributeArrays(), 2)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestElementLevel()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    AbstractFilter::Pointer filter = CreateFilter(dca, true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    CheckOutputs(dca, k_CellPhasesPath, k_CellQuatsPath, "Cell");
+
+    // nothing is written to the feature data
+    AttributeMatrix::Pointer featureAttrMat = dca->getAttributeMatrix(k_FeaturePhasesPath);
+    DREAM3D_REQUIRE_EQUAL(featureAttrMat->getNumAttributeArrays(), 2)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Copies the feature level outputs and removes them from the feature data (a pipeline recreates the created
+   * arrays on every execute)
+   */
+  std::vector<std::vector<float>> TakeOutputs(const DataContainerArray::Pointer& dca)
+  {
+    AttributeMatrix::Pointer featureAttrMat = dca->getAttributeMatrix(k_FeaturePhasesPath);
+    std::vector<std::vector<float>> outputs;
+    for(const QString& name : k_OutputNames)
+    {
+      FloatArrayType::Pointer output = featureAttrMat->getAttributeArrayAs<FloatArrayType>(name);
+      DREAM3D_REQUIRE_VALID_POINTER(output.get())
+      outputs.emplace_back(output->getPointer(0), output->getPointer(0) + output->getSize());
+      featureAttrMat->removeAttributeArray(name);
+    }
+    return outputs;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestIncrementalUpdate()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    AbstractFilter::Pointer filter = CreateFilter(dca, false);
+    QVariant var;
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("IncrementalUpdate", var))
+    FindDirectionalModuli::Pointer moduliFilter = std::dynamic_pointer_cast<FindDirectionalModuli>(filter);
+    DREAM3D_REQUIRE_VALID_POINTER(moduliFilter.get())
+
+    // the first execute evaluates every feature
+    size_t numFeatures = dca->getAttributeMatrix(k_FeaturePhasesPath)->getNumberOfTuples();
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(moduliFilter->getNumberOfRecomputedTuples(), numFeatures)
+    std::vector<std::vector<float>> first = TakeOutputs(dca);
+
+    // unchanged inputs evaluate nothing and reproduce the outputs
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(moduliFilter->getNumberOfRecomputedTuples(), 0)
+    DREAM3D_REQUIRE(TakeOutputs(dca) == first)
+
+    // rotate a few features and change the compliances of the last phase (every fifth feature)
+    FloatArrayType::Pointer avgQuats = dca->getAttributeMatrix(k_AvgQuatsPath)->getAttributeArrayAs<FloatArrayType>(k_AvgQuatsPath.getDataArrayName());
+    Int32ArrayType::Pointer phases = dca->getAttributeMatrix(k_FeaturePhasesPath)->getAttributeArrayAs<Int32ArrayType>(k_FeaturePhasesPath.getDataArrayName());
+    const std::vector<size_t> rotated = {1, 7, 13};
+    for(size_t feature : rotated)
+    {
+      // swap and negate components to get a different unit quaternion
+      float* q = avgQuats->getTuplePointer(feature);
+      std::array<float, 4> swapped = {q[3], -q[2], q[1], q[0]};
+      std::copy(swapped.begin(), swapped.end(), q);
+    }
+    FloatArrayType::Pointer compliances = dca->getAttributeMatrix(k_CrystalCompliancesPath)->getAttributeArrayAs<FloatArrayType>(k_CrystalCompliancesPath.getDataArrayName());
+    int32_t changedPhase = static_cast<int32_t>(compliances->getNumberOfTuples() - 1);
+    for(size_t k = 0; k < 6; k++)
+    {
+      compliances->setComponent(changedPhase, 7 * k, 1.05f * compliances->getComponent(changedPhase, 7 * k));
+    }
+    size_t expected = rotated.size();
+    for(size_t i = 0; i < numFeatures; i++)
+    {
+      if(phases->getValue(i) == changedPhase && std::find(rotated.begin(), rotated.end(), i) == rotated.end())
+      {
+        expected++;
+      }
+    }
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(moduliFilter->getNumberOfRecomputedTuples(), expected)
+    std::vector<std::vector<float>> incremental = TakeOutputs(dca);
+
+    // the merged outputs are bit identical to a full recompute
+    AbstractFilter::Pointer full = CreateFilter(dca, false);
+    full->execute();
+    DREAM3D_REQUIRED(full->getErrorCode(), >=, 0)
+    std::vector<std::vector<float>> recomputed = TakeOutputs(dca);
+    DREAM3D_REQUIRE_EQUAL(incremental.size(), recomputed.size())
+    for(size_t k = 0; k < recomputed.size(); k++)
+    {
+      DREAM3D_REQUIRE_EQUAL(incremental[k].size(), recomputed[k].size())
+      for(size_t j = 0; j < recomputed[k].size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(incremental[k][j], recomputed[k][j])
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability())
+    DREAM3D_REGISTER_TEST(TestFeatureLevel())
+    DREAM3D_REGISTER_TEST(TestElementLevel())
+    DREAM3D_REGISTER_TEST(TestIncrementalUpdate())
+  }
+
+public:
+  FindDirectionalModuliTest(const FindDirectionalModuliTest&) = delete;            // Copy Constructor Not Implemented
+  FindDirectionalModuliTest(FindDirectionalModuliTest&&) = delete;                 // Move Constructor Not Implemented
+  FindDirectionalModuliTest& operator=(const FindDirectionalModuliTest&) = delete; // Copy Assignment Not Implemented
+  FindDirectionalModuliTest& operator=(FindDirectionalModuliTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,733 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                               *
+ * Copyright (c) 2015 The Regents of the University of California, Author: William Lenthe        *
+ *                                                                                               *
+ * This program is free software: you can redistribute it and/or modify it under the terms of    *
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either    *
+ * version 2 of the License, or (at your option) any later version.                              *
+ *                                                                                               *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;     *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.     *
+ * See the GNU Lesser General Public License for more details.                                   *
+ *                                                                                               *
+ * You should have received a copy of the GNU Lesser General Public License                      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.                         *
+ *                                                                                               *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5Utilities.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include "UCSBUtilitiesTestFileLocations.h"
+
+class FindModulusMismatchTest
+{
+
+public:
+  FindModulusMismatchTest() = default;
+  ~FindModulusMismatchTest() = default;
+
+  const QString k_FilterName = QString("FindModulusMismatch");
+  const DataArrayPath k_ModuliPath = {"DataContainer", "FeatureData", "Moduli"};
+  const DataArrayPath k_FaceLabelsPath = {"TriangleDataContainer", "FaceData", "FaceLabels"};
+  const QString k_DeltaModulusName = QString("DeltaModulus");
+  const DataArrayPath k_FeaturePhasesPath = {"DataContainer", "FeatureData", "Phases"};
+  const DataArrayPath k_AvgQuatsPath = {"DataContainer", "FeatureData", "AvgQuats"};
+  const DataArrayPath k_CrystalStructuresPath = {"DataContainer", "EnsembleData", "CrystalStructures"};
+  const DataArrayPath k_CrystalCompliancesPath = {"DataContainer", "EnsembleData", "CrystalCompliances"};
+  const DataArrayPath k_FaceNormalsPath = {"TriangleDataContainer", "FaceData", "FaceNormals"};
+  const DataArrayPath k_FaceAreasPath = {"TriangleDataContainer", "FaceData", "FaceAreas"};
+  const DataArrayPath k_FeatureFaceLabelsPath = {"TriangleDataContainer", "FaceFeatureData", "FaceLabels"};
+  const DataArrayPath k_FeatureFaceDeltaModulusPath = {"TriangleDataContainer", "FaceFeatureData", "DeltaModulus"};
+  const DataArrayPath k_FeatureFaceIdsPath = {"TriangleDataContainer", "FaceData", "FeatureFaceId"};
+
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::FindModulusMismatchTest::FaceLabelsFile);
+    QFile::remove(UnitTest::FindModulusMismatchTest::DeltaModulusFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(k_FilterName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The FindModulusMismatchTest Requires the use of the " << k_FilterName.toStdString() << " filter which is found in the UCSBUtilities Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Builds a grid of numCells^3 features with shuffled ids and the triangles between neighboring cells in spatial
+   * order (so consecutive triangles gather moduli from all over the feature array, like a mesh of a renumbered volume)
+   */
+  DataContainerArray::Pointer CreateMesh(size_t numCells)
+  {
+    std::mt19937_64 generator(12345);
+    size_t numFeatures = numCells * numCells * numCells;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer volume = DataContainer::New(k_ModuliPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(volume);
+    std::vector<size_t> tDims(1, numFeatures + 1);
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tDims, k_ModuliPath.getAttributeMatrixName(), AttributeMatrix::Type::CellFeature);
+    volume->addOrReplaceAttributeMatrix(featureAttrMat);
+    std::vector<size_t> cDims(1, 1);
+    FloatArrayType::Pointer moduli = FloatArrayType::CreateArray(numFeatures + 1, cDims, k_ModuliPath.getDataArrayName(), true);
+    std::uniform_real_distribution<float> distribution(100.0f, 300.0f);
+    for(size_t f = 0; f < moduli->getNumberOfTuples(); f++)
+    {
+      moduli->setValue(f, distribution(generator));
+    }
+    featureAttrMat->insertOrAssign(moduli);
+
+    std::vector<int32_t> ids(numFeatures);
+    std::iota(ids.begin(), ids.end(), 1);
+    std::shuffle(ids.begin(), ids.end(), generator);
+
+    // 3 faces (+x, +y, +z) of 2 triangles per cell, the outer faces border feature -1
+    size_t numTriangles = 6 * numFeatures;
+    DataContainer::Pointer mesh = DataContainer::New(k_FaceLabelsPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(mesh);
+    tDims[0] = numTriangles;
+    AttributeMatrix::Pointer faceAttrMat = AttributeMatrix::New(tDims, k_FaceLabelsPath.getAttributeMatrixName(), AttributeMatrix::Type::Face);
+    mesh->addOrReplaceAttributeMatrix(faceAttrMat);
+    cDims[0] = 2;
+    Int32ArrayType::Pointer labels = Int32ArrayType::CreateArray(numTriangles, cDims, k_FaceLabelsPath.getDataArrayName(), true);
+    int32_t* labelPtr = labels->getPointer(0);
+    size_t triangle = 0;
+    for(size_t z = 0; z < numCells; z++)
+    {
+      for(size_t y = 0; y < numCells; y++)
+      {
+        for(size_t x = 0; x < numCells; x++)
+        {
+          int32_t feature = ids[(z * numCells + y) * numCells + x];
+          int32_t neighbors[3] = {x + 1 < numCells ? ids[(z * numCells + y) * numCells + x + 1] : -1, y + 1 < numCells ? ids[(z * numCells + y + 1) * numCells + x] : -1,
+                                  z + 1 < numCells ? ids[((z + 1) * numCells + y) * numCells + x] : -1};
+          for(int32_t neighbor : neighbors)
+          {
+            for(size_t t = 0; t < 2; t++, triangle++)
+            {
+              labelPtr[2 * triangle] = feature;
+              labelPtr[2 * triangle + 1] = neighbor;
+            }
+          }
+        }
+      }
+    }
+    faceAttrMat->insertOrAssign(labels);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Runs the filter on dca, storing the per triangle mismatch as deltaModulusName
+   */
+  void RunFilter(const DataContainerArray::Pointer& dca, const QString& deltaModulusName)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(k_ModuliPath);
+    DREAM3D_REQUIRE(filter->setProperty("ModuliArrayPath", var))
+    var.setValue(k_FaceLabelsPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFaceLabelsArrayPath", var))
+    var.setValue(deltaModulusName);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshDeltaModulusArrayName", var))
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestTriangleMismatch()
+  {
+    // every triangle must hold the mismatch of the features on either side (0 on the outer surface)
+    DataContainerArray::Pointer dca = CreateMesh(20);
+    RunFilter(dca, k_DeltaModulusName);
+
+    DataArrayPath linearPath(k_FaceLabelsPath.getDataContainerName(), k_FaceLabelsPath.getAttributeMatrixName(), k_DeltaModulusName);
+    FloatArrayType::Pointer linear = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, linearPath, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(linear.get())
+    FloatArrayType::Pointer moduli = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, k_ModuliPath, {1});
+    Int32ArrayType::Pointer labels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FaceLabelsPath, {2});
+    for(size_t i = 0; i < linear->getNumberOfTuples(); i++)
+    {
+      int32_t feature1 = labels->getComponent(i, 0);
+      int32_t feature2 = labels->getComponent(i, 1);
+      float expected = feature1 > 0 && feature2 > 0 ? std::fabs(moduli->getValue(feature1) - moduli->getValue(feature2)) : 0.0f;
+      DREAM3D_REQUIRE_EQUAL(linear->getValue(i), expected)
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Replaces the float moduli of CreateMesh with moduli of type T: integer moduli alternate between the extremes of
+   * the type so that the difference of neighboring features overflows T (it must not wrap)
+   */
+  template <typename T>
+  int TestTypedModuli()
+  {
+    DataContainerArray::Pointer dca = CreateMesh(3);
+    AttributeMatrix::Pointer featureAttrMat = dca->getAttributeMatrix(k_ModuliPath);
+    std::vector<size_t> cDims(1, 1);
+    typename DataArray<T>::Pointer moduli = DataArray<T>::CreateArray(featureAttrMat->getNumberOfTuples(), cDims, k_ModuliPath.getDataArrayName(), true);
+    for(size_t f = 0; f < moduli->getNumberOfTuples(); f++)
+    {
+      if(!std::numeric_limits<T>::is_integer)
+      {
+        moduli->setValue(f, static_cast<T>(100.25 + 7.5 * static_cast<double>(f)));
+      }
+      else
+      {
+        moduli->setValue(f, f % 3 == 0 ? std::numeric_limits<T>::lowest() : f % 3 == 1 ? std::numeric_limits<T>::max() : static_cast<T>(f));
+      }
+    }
+    featureAttrMat->insertOrAssign(moduli);
+    RunFilter(dca, k_DeltaModulusName);
+
+    DataArrayPath linearPath(k_FaceLabelsPath.getDataContainerName(), k_FaceLabelsPath.getAttributeMatrixName(), k_DeltaModulusName);
+    FloatArrayType::Pointer linear = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, linearPath, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(linear.get())
+    Int32ArrayType::Pointer labels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FaceLabelsPath, {2});
+    for(size_t i = 0; i < linear->getNumberOfTuples(); i++)
+    {
+      int32_t feature1 = labels->getComponent(i, 0);
+      int32_t feature2 = labels->getComponent(i, 1);
+      double expected = 0.0;
+      if(feature1 > 0 && feature2 > 0)
+      {
+        expected = std::fabs(static_cast<double>(moduli->getValue(feature1)) - static_cast<double>(moduli->getValue(feature2)));
+      }
+      // the filter rounds the exact difference to float, the reference rounds the moduli to double first
+      DREAM3D_REQUIRED(std::fabs(static_cast<double>(linear->getValue(i)) - expected), <=, 1.0e-6 * expected)
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestMultiComponentModuli()
+  {
+    // moduli with 3 components (e.g. along x, y and z) must give a 3 component mismatch, one difference per component
+    const size_t numComponents = 3;
+    DataContainerArray::Pointer dca = CreateMesh(4);
+    AttributeMatrix::Pointer featureAttrMat = dca->getAttributeMatrix(k_ModuliPath);
+    std::vector<size_t> cDims(1, numComponents);
+    FloatArrayType::Pointer moduli = FloatArrayType::CreateArray(featureAttrMat->getNumberOfTuples(), cDims, k_ModuliPath.getDataArrayName(), true);
+    std::mt19937_64 generator(6789);
+    std::uniform_real_distribution<float> distribution(100.0f, 300.0f);
+    for(size_t i = 0; i < moduli->getSize(); i++)
+    {
+      moduli->setValue(i, distribution(generator));
+    }
+    featureAttrMat->insertOrAssign(moduli);
+    RunFilter(dca, k_DeltaModulusName);
+
+    DataArrayPath linearPath(k_FaceLabelsPath.getDataContainerName(), k_FaceLabelsPath.getAttributeMatrixName(), k_DeltaModulusName);
+    FloatArrayType::Pointer linear = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, linearPath, cDims);
+    DREAM3D_REQUIRE_VALID_POINTER(linear.get())
+    DREAM3D_REQUIRE_EQUAL(linear->getNumberOfComponents(), numComponents)
+    Int32ArrayType::Pointer labels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FaceLabelsPath, {2});
+    for(size_t i = 0; i < linear->getNumberOfTuples(); i++)
+    {
+      int32_t feature1 = labels->getComponent(i, 0);
+      int32_t feature2 = labels->getComponent(i, 1);
+      for(size_t c = 0; c < numComponents; c++)
+      {
+        float expected = feature1 > 0 && feature2 > 0 ? std::fabs(moduli->getComponent(feature1, c) - moduli->getComponent(feature2, c)) : 0.0f;
+        DREAM3D_REQUIRE_EQUAL(linear->getComponent(i, c), expected)
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFaceNormals()
+  {
+    // cubic compliances (copper, 1/GPa): along <uvw> 1/s'11 = 1 / (S11 - 2 (S11 - S12 - S44 / 2) (u^2 v^2 + v^2 w^2 + w^2 u^2))
+    const double s11 = 0.0150;
+    const double s12 = -0.0063;
+    const double s44 = 0.0133;
+    const double anisotropy = 2.0 * (s11 - s12 - 0.5 * s44);
+    const double e100 = 1.0 / s11;
+    const double e110 = 1.0 / (s11 - anisotropy / 4.0);
+    const double e111 = 1.0 / (s11 - anisotropy / 3.0);
+
+    // feature 1 is unrotated, feature 2 is rotated 45 degrees about z (x and y become <110>) and feature 3 is rotated about
+    // [0 -1 1] so that x becomes <111> (the sense of either rotation doesn't change the direction family)
+    const double angle111 = std::acos(1.0 / std::sqrt(3.0));
+    const std::array<std::array<float, 4>, 4> quats = {{{0.0f, 0.0f, 0.0f, 1.0f},
+                                                        {0.0f, 0.0f, 0.0f, 1.0f},
+                                                        {0.0f, 0.0f, static_cast<float>(std::sin(M_PI / 8.0)), static_cast<float>(std::cos(M_PI / 8.0))},
+                                                        {0.0f, static_cast<float>(-std::sin(0.5 * angle111) / std::sqrt(2.0)), static_cast<float>(std::sin(0.5 * angle111) / std::sqrt(2.0)),
+                                                         static_cast<float>(std::cos(0.5 * angle111))}}};
+
+    // feature 1, feature 2, normal, expected mismatch (normals aren't normalized and point either way)
+    struct Triangle
+    {
+      int32_t feature1;
+      int32_t feature2;
+      std::array<double, 3> normal;
+      double expected;
+    };
+    const std::vector<Triangle> triangles = {{1, 2, {1.0, 0.0, 0.0}, std::fabs(e100 - e110)}, {2, 1, {0.0, -2.0, 0.0}, std::fabs(e110 - e100)}, {1, 2, {0.0, 0.0, 0.5}, 0.0},
+                                             {1, 3, {-1.0, 0.0, 0.0}, std::fabs(e100 - e111)}, {3, 2, {3.0, 0.0, 0.0}, std::fabs(e111 - e110)}, {1, -1, {1.0, 0.0, 0.0}, 0.0},
+                                             {0, 2, {1.0, 0.0, 0.0}, 0.0}};
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer volume = DataContainer::New(k_AvgQuatsPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(volume);
+    std::vector<size_t> tDims(1, 2);
+    AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(tDims, k_CrystalStructuresPath.getAttributeMatrixName(), AttributeMatrix::Type::CellEnsemble);
+    volume->addOrReplaceAttributeMatrix(ensembleAttrMat);
+    std::vector<size_t> cDims(1, 1);
+    UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(2, cDims, k_CrystalStructuresPath.getDataArrayName(), true);
+    crystalStructures->setValue(0, EbsdLib::CrystalStructure::UnknownCrystalStructure);
+    crystalStructures->setValue(1, EbsdLib::CrystalStructure::Cubic_High);
+    ensembleAttrMat->insertOrAssign(crystalStructures);
+    std::vector<size_t> complianceDims(2, 6);
+    FloatArrayType::Pointer compliances = FloatArrayType::CreateArray(2, complianceDims, k_CrystalCompliancesPath.getDataArrayName(), true);
+    compliances->initializeWithZeros();
+    for(size_t i = 0; i < 3; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        compliances->setComponent(1, 6 * i + j, static_cast<float>(i == j ? s11 : s12));
+      }
+      compliances->setComponent(1, 6 * (i + 3) + i + 3, static_cast<float>(s44));
+    }
+    ensembleAttrMat->insertOrAssign(compliances);
+
+    tDims[0] = quats.size();
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tDims, k_AvgQuatsPath.getAttributeMatrixName(), AttributeMatrix::Type::CellFeature);
+    volume->addOrReplaceAttributeMatrix(featureAttrMat);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(quats.size(), cDims, k_FeaturePhasesPath.getDataArrayName(), true);
+    cDims[0] = 4;
+    FloatArrayType::Pointer avgQuats = FloatArrayType::CreateArray(quats.size(), cDims, k_AvgQuatsPath.getDataArrayName(), true);
+    for(size_t f = 0; f < quats.size(); f++)
+    {
+      phases->setValue(f, f == 0 ? 0 : 1);
+      for(size_t j = 0; j < 4; j++)
+      {
+        avgQuats->setComponent(f, j, quats[f][j]);
+      }
+    }
+    featureAttrMat->insertOrAssign(phases);
+    featureAttrMat->insertOrAssign(avgQuats);
+
+    DataContainer::Pointer mesh = DataContainer::New(k_FaceLabelsPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(mesh);
+    tDims[0] = triangles.size();
+    AttributeMatrix::Pointer faceAttrMat = AttributeMatrix::New(tDims, k_FaceLabelsPath.getAttributeMatrixName(), AttributeMatrix::Type::Face);
+    mesh->addOrReplaceAttributeMatrix(faceAttrMat);
+    cDims[0] = 2;
+    Int32ArrayType::Pointer labels = Int32ArrayType::CreateArray(triangles.size(), cDims, k_FaceLabelsPath.getDataArrayName(), true);
+    cDims[0] = 3;
+    DoubleArrayType::Pointer normals = DoubleArrayType::CreateArray(triangles.size(), cDims, k_FaceNormalsPath.getDataArrayName(), true);
+    for(size_t t = 0; t < triangles.size(); t++)
+    {
+      labels->setComponent(t, 0, triangles[t].feature1);
+      labels->setComponent(t, 1, triangles[t].feature2);
+      for(size_t j = 0; j < 3; j++)
+      {
+        normals->setComponent(t, j, triangles[t].normal[j]);
+      }
+    }
+    faceAttrMat->insertOrAssign(labels);
+    faceAttrMat->insertOrAssign(normals);
+
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+    QVariant var;
+    var.setValue(1);
+    DREAM3D_REQUIRE(filter->setProperty("MismatchMode", var))
+    var.setValue(k_FaceLabelsPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFaceLabelsArrayPath", var))
+    var.setValue(k_FaceNormalsPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFaceNormalsArrayPath", var))
+    var.setValue(k_FeaturePhasesPath);
+    DREAM3D_REQUIRE(filter->setProperty("FeaturePhasesArrayPath", var))
+    var.setValue(k_AvgQuatsPath);
+    DREAM3D_REQUIRE(filter->setProperty("AvgQuatsArrayPath", var))
+    var.setValue(k_CrystalStructuresPath);
+    DREAM3D_REQUIRE(filter->setProperty("CrystalStructuresArrayPath", var))
+    var.setValue(k_CrystalCompliancesPath);
+    DREAM3D_REQUIRE(filter->setProperty("CrystalCompliancesArrayPath", var))
+    var.setValue(k_DeltaModulusName);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshDeltaModulusArrayName", var))
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataArrayPath deltaPath(k_FaceLabelsPath.getDataContainerName(), k_FaceLabelsPath.getAttributeMatrixName(), k_DeltaModulusName);
+    FloatArrayType::Pointer delta = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, deltaPath, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(delta.get())
+    for(size_t t = 0; t < triangles.size(); t++)
+    {
+      // the kernels work in single precision
+      DREAM3D_REQUIRED(std::fabs(delta->getValue(t) - triangles[t].expected), <=, 1.0E-4 * e111)
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Runs the filter on dca with statistics enabled, writing them into statisticsName
+   */
+  void RunStatistics(const DataContainerArray::Pointer& dca, const QString& statisticsName, int numBins, bool storeTriangleMismatch)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(k_ModuliPath);
+    DREAM3D_REQUIRE(filter->setProperty("ModuliArrayPath", var))
+    var.setValue(k_FaceLabelsPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFaceLabelsArrayPath", var))
+    var.setValue(k_DeltaModulusName);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshDeltaModulusArrayName", var))
+    var.setValue(storeTriangleMismatch);
+    DREAM3D_REQUIRE(filter->setProperty("StoreTriangleMismatch", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("ComputeStatistics", var))
+    var.setValue(k_FaceAreasPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFaceAreasArrayPath", var))
+    var.setValue(numBins);
+    DREAM3D_REQUIRE(filter->setProperty("NumberOfBins", var))
+    var.setValue(statisticsName);
+    DREAM3D_REQUIRE(filter->setProperty("MismatchStatisticsAttributeMatrixName", var))
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestStatistics()
+  {
+    const int numBins = 16;
+    DataContainerArray::Pointer dca = CreateMesh(8);
+    FloatArrayType::Pointer moduli = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, k_ModuliPath, {1});
+    Int32ArrayType::Pointer labels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FaceLabelsPath, {2});
+    DREAM3D_REQUIRE_VALID_POINTER(moduli.get())
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get())
+
+    // random triangle areas
+    std::mt19937_64 generator(54321);
+    std::uniform_real_distribution<double> distribution(0.1, 2.0);
+    size_t numTriangles = labels->getNumberOfTuples();
+    std::vector<size_t> cDims(1, 1);
+    DoubleArrayType::Pointer areas = DoubleArrayType::CreateArray(numTriangles, cDims, k_FaceAreasPath.getDataArrayName(), true);
+    for(size_t t = 0; t < numTriangles; t++)
+    {
+      areas->setValue(t, distribution(generator));
+    }
+    dca->getAttributeMatrix(k_FaceAreasPath)->insertOrAssign(areas);
+
+    // serial area weighted reference: the histogram spans [0, range of the moduli over the features]
+    std::pair<float, float> range(moduli->getValue(1), moduli->getValue(1));
+    for(size_t f = 2; f < moduli->getNumberOfTuples(); f++)
+    {
+      range.first = std::min(range.first, moduli->getValue(f));
+      range.second = std::max(range.second, moduli->getValue(f));
+    }
+    float maximum = range.second - range.first;
+    float binScale = static_cast<float>(numBins) / maximum;
+    std::vector<double> histogram(numBins, 0.0);
+    std::vector<std::pair<float, double>> weighted;
+    double totalArea = 0.0;
+    double firstMoment = 0.0;
+    double secondMoment = 0.0;
+    for(size_t t = 0; t < numTriangles; t++)
+    {
+      int32_t feature1 = labels->getComponent(t, 0);
+      int32_t feature2 = labels->getComponent(t, 1);
+      if(feature1 <= 0 || feature2 <= 0)
+      {
+        continue;
+      }
+      float delta = std::fabs(moduli->getValue(feature1) - moduli->getValue(feature2));
+      double area = areas->getValue(t);
+      totalArea += area;
+      firstMoment += area * delta;
+      secondMoment += area * delta * delta;
+      size_t bin = std::min(static_cast<size_t>(delta * binScale), static_cast<size_t>(numBins - 1));
+      histogram[bin] += area;
+      weighted.emplace_back(delta, area);
+    }
+    double mean = firstMoment / totalArea;
+    double variance = secondMoment / totalArea - mean * mean;
+
+    // exact area weighted percentiles, the filter interpolates them within its bins
+    std::sort(weighted.begin(), weighted.end());
+    const std::array<double, 5> percentiles = {5.0, 25.0, 50.0, 75.0, 95.0};
+    std::array<double, 5> exactPercentiles = {0.0, 0.0, 0.0, 0.0, 0.0};
+    for(size_t p = 0; p < percentiles.size(); p++)
+    {
+      double target = totalArea * percentiles[p] / 100.0;
+      double cumulative = 0.0;
+      size_t i = 0;
+      while(i + 1 < weighted.size() && cumulative + weighted[i].second < target)
+      {
+        cumulative += weighted[i++].second;
+      }
+      exactPercentiles[p] = weighted[i].first;
+    }
+
+    // the statistics must not depend on whether the per triangle mismatch is stored
+    const std::array<QString, 2> statisticsNames = {QString("MismatchStatistics"), QString("MismatchStatisticsOnly")};
+    AttributeMatrix::Pointer faceAttrMat = dca->getAttributeMatrix(k_FaceLabelsPath);
+    RunStatistics(dca, statisticsNames[0], numBins, true);
+    DREAM3D_REQUIRE_VALID_POINTER(faceAttrMat->getAttributeArray(k_DeltaModulusName).get())
+    faceAttrMat->removeAttributeArray(k_DeltaModulusName);
+    RunStatistics(dca, statisticsNames[1], numBins, false);
+    DREAM3D_REQUIRE_EQUAL(nullptr == faceAttrMat->getAttributeArray(k_DeltaModulusName).get(), true)
+
+    for(const QString& statisticsName : statisticsNames)
+    {
+      DataArrayPath path(k_FaceLabelsPath.getDataContainerName(), statisticsName, "AreaHistogram");
+      FloatArrayType::Pointer histogramArray = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {static_cast<size_t>(numBins)});
+      path.setDataArrayName("HistogramBounds");
+      FloatArrayType::Pointer boundsArray = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {2});
+      path.setDataArrayName("Mean");
+      FloatArrayType::Pointer meanArray = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {1});
+      path.setDataArrayName("Variance");
+      FloatArrayType::Pointer varianceArray = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {1});
+      path.setDataArrayName("Percentiles");
+      FloatArrayType::Pointer percentilesArray = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {percentiles.size()});
+      DREAM3D_REQUIRE_VALID_POINTER(histogramArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(boundsArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(meanArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(varianceArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(percentilesArray.get())
+
+      double sum = 0.0;
+      for(int j = 0; j < numBins; j++)
+      {
+        DREAM3D_REQUIRED(std::fabs(histogramArray->getComponent(0, j) - histogram[j] / totalArea), <=, 1.0E-5)
+        sum += histogramArray->getComponent(0, j);
+      }
+      DREAM3D_REQUIRED(std::fabs(sum - 1.0), <=, 1.0E-4)
+      DREAM3D_REQUIRE_EQUAL(boundsArray->getComponent(0, 0), 0.0f)
+      DREAM3D_REQUIRE_EQUAL(boundsArray->getComponent(0, 1), maximum)
+      DREAM3D_REQUIRED(std::fabs(meanArray->getValue(0) - mean), <=, 1.0E-5 * mean)
+      DREAM3D_REQUIRED(std::fabs(varianceArray->getValue(0) - variance), <=, 1.0E-4 * variance)
+
+      // interpolated within a bin, so within a bin width of the exact value
+      float binWidth = maximum / static_cast<float>(numBins);
+      for(size_t p = 0; p < percentiles.size(); p++)
+      {
+        DREAM3D_REQUIRED(std::fabs(percentilesArray->getComponent(0, p) - exactPercentiles[p]), <=, binWidth)
+        if(p > 0)
+        {
+          DREAM3D_REQUIRED(percentilesArray->getComponent(0, p), >=, percentilesArray->getComponent(0, p - 1))
+        }
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFeaturePairs()
+  {
+    // the per pair mismatch must match the per triangle one (the mesh has both label orders and outer surface triangles)
+    DataContainerArray::Pointer dca = CreateMesh(6);
+    RunFilter(dca, k_DeltaModulusName);
+
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+    QVariant var;
+    var.setValue(k_ModuliPath);
+    DREAM3D_REQUIRE(filter->setProperty("ModuliArrayPath", var))
+    var.setValue(k_FaceLabelsPath);
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFaceLabelsArrayPath", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("DeduplicatePairs", var))
+    var.setValue(k_FeatureFaceLabelsPath.getAttributeMatrixName());
+    DREAM3D_REQUIRE(filter->setProperty("FaceFeatureAttributeMatrixName", var))
+    var.setValue(k_FeatureFaceLabelsPath.getDataArrayName());
+    DREAM3D_REQUIRE(filter->setProperty("FeatureFaceLabelsArrayName", var))
+    var.setValue(k_FeatureFaceDeltaModulusPath.getDataArrayName());
+    DREAM3D_REQUIRE(filter->setProperty("FeatureFaceDeltaModulusArrayName", var))
+    var.setValue(k_FeatureFaceIdsPath.getDataArrayName());
+    DREAM3D_REQUIRE(filter->setProperty("SurfaceMeshFeatureFaceIdsArrayName", var))
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataArrayPath linearPath(k_FaceLabelsPath.getDataContainerName(), k_FaceLabelsPath.getAttributeMatrixName(), k_DeltaModulusName);
+    FloatArrayType::Pointer linear = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, linearPath, {1});
+    Int32ArrayType::Pointer labels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FaceLabelsPath, {2});
+    Int32ArrayType::Pointer pairLabels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FeatureFaceLabelsPath, {2});
+    FloatArrayType::Pointer pairDelta = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, k_FeatureFaceDeltaModulusPath, {1});
+    Int32ArrayType::Pointer featureFaceIds = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FeatureFaceIdsPath, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(linear.get())
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get())
+    DREAM3D_REQUIRE_VALID_POINTER(pairLabels.get())
+    DREAM3D_REQUIRE_VALID_POINTER(pairDelta.get())
+    DREAM3D_REQUIRE_VALID_POINTER(featureFaceIds.get())
+
+    // one tuple per unique (unordered) pair plus the reserved pair 0
+    std::vector<std::pair<int32_t, int32_t>> uniquePairs;
+    for(size_t t = 0; t < labels->getNumberOfTuples(); t++)
+    {
+      int32_t feature1 = labels->getComponent(t, 0);
+      int32_t feature2 = labels->getComponent(t, 1);
+      if(feature1 > 0 && feature2 > 0)
+      {
+        uniquePairs.emplace_back(std::min(feature1, feature2), std::max(feature1, feature2));
+      }
+    }
+    std::sort(uniquePairs.begin(), uniquePairs.end());
+    uniquePairs.erase(std::unique(uniquePairs.begin(), uniquePairs.end()), uniquePairs.end());
+    DREAM3D_REQUIRE_EQUAL(pairLabels->getNumberOfTuples(), uniquePairs.size() + 1)
+    DREAM3D_REQUIRE_EQUAL(pairDelta->getNumberOfTuples(), uniquePairs.size() + 1)
+
+    // pair 0 is reserved, the others are sorted with the smaller feature id first
+    DREAM3D_REQUIRE_EQUAL(pairLabels->getComponent(0, 0), 0)
+    DREAM3D_REQUIRE_EQUAL(pairLabels->getComponent(0, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(pairDelta->getValue(0), 0.0f)
+    for(size_t p = 0; p < uniquePairs.size(); p++)
+    {
+      DREAM3D_REQUIRE_EQUAL(pairLabels->getComponent(p + 1, 0), uniquePairs[p].first)
+      DREAM3D_REQUIRE_EQUAL(pairLabels->getComponent(p + 1, 1), uniquePairs[p].second)
+    }
+
+    // each triangle indexes the pair of its features (in either order) and the pair holds the triangle's mismatch
+    for(size_t t = 0; t < labels->getNumberOfTuples(); t++)
+    {
+      int32_t feature1 = labels->getComponent(t, 0);
+      int32_t feature2 = labels->getComponent(t, 1);
+      int32_t id = featureFaceIds->getValue(t);
+      if(feature1 > 0 && feature2 > 0)
+      {
+        DREAM3D_REQUIRED(id, >, 0)
+        DREAM3D_REQUIRE_EQUAL(pairLabels->getComponent(id, 0), std::min(feature1, feature2))
+        DREAM3D_REQUIRE_EQUAL(pairLabels->getComponent(id, 1), std::max(feature1, feature2))
+      }
+      else
+      {
+        DREAM3D_REQUIRE_EQUAL(id, 0)
+      }
+      DREAM3D_REQUIRE_EQUAL(pairDelta->getValue(id), linear->getValue(t))
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestStreamingThroughFiles()
+  {
+    // the mismatch streamed between files (in chunks that don't divide the triangles) must match the in memory one
+    DataContainerArray::Pointer dca = CreateMesh(12);
+    RunFilter(dca, k_DeltaModulusName);
+    DataArrayPath linearPath(k_FaceLabelsPath.getDataContainerName(), k_FaceLabelsPath.getAttributeMatrixName(), k_DeltaModulusName);
+    FloatArrayType::Pointer linear = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, linearPath, {1});
+    Int32ArrayType::Pointer labels = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, k_FaceLabelsPath, {2});
+    DREAM3D_REQUIRE_VALID_POINTER(linear.get())
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get())
+
+    hid_t fileId = H5Support::H5Utilities::createFile(UnitTest::FindModulusMismatchTest::FaceLabelsFile.toStdString());
+    DREAM3D_REQUIRED(fileId, >, 0)
+    hsize_t dims[2] = {labels->getNumberOfTuples(), 2};
+    herr_t err = H5Support::H5Lite::writePointerDataset(fileId, "FaceLabels", 2, dims, labels->getPointer(0));
+    DREAM3D_REQUIRED(err, >=, 0)
+    H5Support::H5Utilities::closeFile(fileId);
+
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName(k_FilterName)->create();
+    filter->setDataContainerArray(dca);
+    QVariant var;
+    var.setValue(k_ModuliPath);
+    DREAM3D_REQUIRE(filter->setProperty("ModuliArrayPath", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("StreamFromFile", var))
+    var.setValue(UnitTest::FindModulusMismatchTest::FaceLabelsFile);
+    DREAM3D_REQUIRE(filter->setProperty("StreamingInputFile", var))
+    var.setValue(QString("FaceLabels"));
+    DREAM3D_REQUIRE(filter->setProperty("StreamingFaceLabelsDatasetPath", var))
+    var.setValue(UnitTest::FindModulusMismatchTest::DeltaModulusFile);
+    DREAM3D_REQUIRE(filter->setProperty("StreamingOutputFile", var))
+    var.setValue(QString("Mismatch/DeltaModulus"));
+    DREAM3D_REQUIRE(filter->setProperty("StreamingDeltaModulusDatasetPath", var))
+    var.setValue(1000);
+    DREAM3D_REQUIRE(filter->setProperty("StreamingChunkSize", var))
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    std::vector<float> streamed(linear->getNumberOfTuples());
+    fileId = H5Support::H5Utilities::openFile(UnitTest::FindModulusMismatchTest::DeltaModulusFile.toStdString(), true);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    err = H5Support::H5Lite::readPointerDataset(fileId, "Mismatch/DeltaModulus", streamed.data());
+    DREAM3D_REQUIRED(err, >=, 0)
+    H5Support::H5Utilities::closeFile(fileId);
+    for(size_t i = 0; i < streamed.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(streamed[i], linear->getValue(i))
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability())
+    DREAM3D_REGISTER_TEST(TestTriangleMismatch())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<double>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<int8_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<uint8_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<int16_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<uint16_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<int32_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<uint32_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<int64_t>())
+    DREAM3D_REGISTER_TEST(TestTypedModuli<uint64_t>())
+    DREAM3D_REGISTER_TEST(TestMultiComponentModuli())
+    DREAM3D_REGISTER_TEST(TestFaceNormals())
+    DREAM3D_REGISTER_TEST(TestStatistics())
+    DREAM3D_REGISTER_TEST(TestFeaturePairs())
+    DREAM3D_REGISTER_TEST(TestStreamingThroughFiles())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  FindModulusMismatchTest(const FindModulusMismatchTest&) = delete;            // Copy Constructor Not Implemented
+  FindModulusMismatchTest(FindModulusMismatchTest&&) = delete;                 // Move Constructor Not Implemented
+  FindModulusMismatchTest& operator=(const FindModulusMismatchTest&) = delete; // Copy Assignment Not Implemented
+  FindModulusMismatchTest& operator=(FindModulusMismatchTest&&) = delete;      // Move Assignment Not Implemented
+};
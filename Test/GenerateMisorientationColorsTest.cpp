@@ -30,7 +30,12 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
 #include <random>
+#include <vector>
 
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -38,6 +43,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
@@ -47,6 +53,10 @@
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "UnitTestSupport.hpp"
 
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include "UCSBUtilitiesFilters/LaueOps/CubicOpsMisoColor.h"
+#include "UCSBUtilitiesFilters/LaueOps/HexagonalOpsMisoColor.h"
 #include "UCSBUtilitiesFilters/util/UCSBHelpers.h"
 #include "UCSBUtilitiesTestFileLocations.h"
 
@@ -63,6 +73,14 @@ public:
 
   const DataArrayPath k_ExemplarPath = {"Exemplar Data", "CellData", "Exemplar Image"};
 
+  const DataArrayPath k_FeatureIdsPath = {"Volume", "CellData", "FeatureIds"};
+  const DataArrayPath k_QuatsPath = {"Volume", "CellData", "Quats"};
+  const DataArrayPath k_CellPhasesPath = {"Volume", "CellData", "Phases"};
+  const DataArrayPath k_MaskPath = {"Volume", "CellData", "Mask"};
+  const DataArrayPath k_AvgQuatsPath = {"Volume", "CellFeatureData", "AvgQuats"};
+  const DataArrayPath k_FeaturePhasesPath = {"Volume", "CellFeatureData", "Phases"};
+  const DataArrayPath k_CrystalStructuresPath = {"Volume", "CellEnsembleData", "CrystalStructures"};
+
   // -----------------------------------------------------------------------------
   void RemoveTestFiles()
   {
@@ -72,7 +90,12 @@ public:
   }
 
   // -----------------------------------------------------------------------------
-  int32_t TestMisorientationColors()
+  /**
+   * @brief Runs the example pipeline on the Small IN100 slice and compares the colors with the exemplar image
+   * @param useFastMath Compute the colors in single precision
+   * @param maxError Largest difference per channel allowed against the exemplar
+   */
+  int32_t RunExemplarPipeline(bool useFastMath, int32_t maxError)
   {
     QString pipelineFile = UnitTest::PluginSourceDir + "/" + "ExamplePipelines/" + UnitTest::PluginName + "/" + k_PipelineFileName;
 
@@ -109,6 +132,10 @@ public:
     didSet = filters[6]->setProperty("FileName", var);
     DREAM3D_REQUIRE(didSet)
 
+    var.setValue(useFastMath);
+    didSet = filters[5]->setProperty("UseFastMath", var);
+    DREAM3D_REQUIRE(didSet)
+
     Observer obs; // Create an Observer to report errors/progress from the executing pipeline
     pipeline->addMessageReceiver(&obs);
     // Preflight the pipeline
@@ -150,17 +177,299 @@ public:
       //        std::cout << "Output Color Channel:" << static_cast<int32_t>((*misoColors)[i]) << std::endl;
       //        std::cout << "Exemplar Color Channel:" << static_cast<int32_t>((*exemplarColors)[i]) << std::endl;
       //      }
-      DREAM3D_REQUIRED((*misoColors)[i], ==, (*exemplarColors)[i])
+      int32_t error = std::abs(static_cast<int32_t>((*misoColors)[i]) - static_cast<int32_t>((*exemplarColors)[i]));
+      DREAM3D_REQUIRED(error, <=, maxError)
     }
 
     return 0;
   }
 
+  // -----------------------------------------------------------------------------
+  int32_t TestMisorientationColors()
+  {
+    return RunExemplarPipeline(false, 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  int32_t TestFastMisorientationColors()
+  {
+    // the single precision colors must stay within 1 of the exemplar in every channel
+    return RunExemplarPipeline(true, 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Builds a volume of random Features (cubic and hexagonal phases) whose elements carry the average
+   * orientation and phase of their Feature, and a random mask
+   */
+  DataContainerArray::Pointer CreateVolume(size_t numFeatures, size_t numElements)
+  {
+    std::mt19937_64 generator(4321);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer volume = DataContainer::New(k_FeatureIdsPath.getDataContainerName());
+    dca->addOrReplaceDataContainer(volume);
+
+    std::vector<size_t> tDims(1, 3);
+    AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(tDims, k_CrystalStructuresPath.getAttributeMatrixName(), AttributeMatrix::Type::CellEnsemble);
+    volume->addOrReplaceAttributeMatrix(ensembleAttrMat);
+    std::vector<size_t> cDims(1, 1);
+    UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(3, cDims, k_CrystalStructuresPath.getDataArrayName(), true);
+    crystalStructures->setValue(0, EbsdLib::CrystalStructure::UnknownCrystalStructure);
+    crystalStructures->setValue(1, EbsdLib::CrystalStructure::Cubic_High);
+    crystalStructures->setValue(2, EbsdLib::CrystalStructure::Hexagonal_High);
+    ensembleAttrMat->insertOrAssign(crystalStructures);
+
+    tDims[0] = numFeatures + 1;
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tDims, k_AvgQuatsPath.getAttributeMatrixName(), AttributeMatrix::Type::CellFeature);
+    volume->addOrReplaceAttributeMatrix(featureAttrMat);
+    Int32ArrayType::Pointer featurePhases = Int32ArrayType::CreateArray(numFeatures + 1, cDims, k_FeaturePhasesPath.getDataArrayName(), true);
+    cDims[0] = 4;
+    FloatArrayType::Pointer avgQuats = FloatArrayType::CreateArray(numFeatures + 1, cDims, k_AvgQuatsPath.getDataArrayName(), true);
+    for(size_t f = 0; f <= numFeatures; f++)
+    {
+      featurePhases->setValue(f, f == 0 ? 0 : static_cast<int32_t>(1 + generator() % 2));
+      float quat[4] = {normal(generator), normal(generator), normal(generator), normal(generator)};
+      float norm = std::sqrt(quat[0] * quat[0] + quat[1] * quat[1] + quat[2] * quat[2] + quat[3] * quat[3]);
+      for(size_t c = 0; c < 4; c++)
+      {
+        avgQuats->setComponent(f, c, quat[c] / norm);
+      }
+    }
+    featureAttrMat->insertOrAssign(featurePhases);
+    featureAttrMat->insertOrAssign(avgQuats);
+
+    tDims[0] = numElements;
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, k_FeatureIdsPath.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    volume->addOrReplaceAttributeMatrix(cellAttrMat);
+    cDims[0] = 1;
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numElements, cDims, k_FeatureIdsPath.getDataArrayName(), true);
+    Int32ArrayType::Pointer cellPhases = Int32ArrayType::CreateArray(numElements, cDims, k_CellPhasesPath.getDataArrayName(), true);
+    BoolArrayType::Pointer mask = BoolArrayType::CreateArray(numElements, cDims, k_MaskPath.getDataArrayName(), true);
+    cDims[0] = 4;
+    FloatArrayType::Pointer quats = FloatArrayType::CreateArray(numElements, cDims, k_QuatsPath.getDataArrayName(), true);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      // runs of elements in the same Feature, like a scan line crossing grains
+      int32_t feature = static_cast<int32_t>((i / 7 + generator() % 2) % (numFeatures + 1));
+      featureIds->setValue(i, feature);
+      cellPhases->setValue(i, featurePhases->getValue(feature));
+      mask->setValue(i, generator() % 10 != 0);
+      for(size_t c = 0; c < 4; c++)
+      {
+        quats->setComponent(i, c, avgQuats->getComponent(feature, c));
+      }
+    }
+    cellAttrMat->insertOrAssign(featureIds);
+    cellAttrMat->insertOrAssign(cellPhases);
+    cellAttrMat->insertOrAssign(mask);
+    cellAttrMat->insertOrAssign(quats);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  void RunFilter(const DataContainerArray::Pointer& dca, int orientationSource, const QString& colorsName, bool useLookupTables = false)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName("GenerateMisorientationColors")->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(orientationSource);
+    DREAM3D_REQUIRE(filter->setProperty("OrientationSource", var))
+    var.setValue(useLookupTables);
+    DREAM3D_REQUIRE(filter->setProperty("UseLookupTables", var))
+    var.setValue(k_QuatsPath);
+    DREAM3D_REQUIRE(filter->setProperty("QuatsArrayPath", var))
+    var.setValue(k_CellPhasesPath);
+    DREAM3D_REQUIRE(filter->setProperty("CellPhasesArrayPath", var))
+    var.setValue(k_FeatureIdsPath);
+    DREAM3D_REQUIRE(filter->setProperty("FeatureIdsArrayPath", var))
+    var.setValue(k_AvgQuatsPath);
+    DREAM3D_REQUIRE(filter->setProperty("AvgQuatsArrayPath", var))
+    var.setValue(k_FeaturePhasesPath);
+    DREAM3D_REQUIRE(filter->setProperty("FeaturePhasesArrayPath", var))
+    var.setValue(k_CrystalStructuresPath);
+    DREAM3D_REQUIRE(filter->setProperty("CrystalStructuresArrayPath", var))
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("UseGoodVoxels", var))
+    var.setValue(k_MaskPath);
+    DREAM3D_REQUIRE(filter->setProperty("GoodVoxelsArrayPath", var))
+    var.setValue(colorsName);
+    DREAM3D_REQUIRE(filter->setProperty("MisorientationColorArrayName", var))
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  int32_t TestFeatureOrientations()
+  {
+    // coloring each Feature once and broadcasting must reproduce the colors of elements holding the Feature orientation
+    DataContainerArray::Pointer dca = CreateVolume(500, 20000);
+    RunFilter(dca, 0, "ElementColors");
+    RunFilter(dca, 1, "FeatureColors");
+
+    DataArrayPath elementColorsPath(k_FeatureIdsPath.getDataContainerName(), k_FeatureIdsPath.getAttributeMatrixName(), "ElementColors");
+    DataArrayPath featureColorsPath(k_FeatureIdsPath.getDataContainerName(), k_FeatureIdsPath.getAttributeMatrixName(), "FeatureColors");
+    UInt8ArrayType::Pointer elementColors = dca->getPrereqArrayFromPath<UInt8ArrayType>(nullptr, elementColorsPath, {3});
+    UInt8ArrayType::Pointer featureColors = dca->getPrereqArrayFromPath<UInt8ArrayType>(nullptr, featureColorsPath, {3});
+    DREAM3D_REQUIRE_VALID_POINTER(elementColors.get())
+    DREAM3D_REQUIRE_VALID_POINTER(featureColors.get())
+    for(size_t i = 0; i < elementColors->size(); i++)
+    {
+      DREAM3D_REQUIRED((*featureColors)[i], ==, (*elementColors)[i])
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int32_t TestLookupTables()
+  {
+    // the interpolated colors must stay within the maximum error documented for the lookup tables
+    DataContainerArray::Pointer dca = CreateVolume(500, 20000);
+    RunFilter(dca, 0, "ExactColors");
+    RunFilter(dca, 0, "TableColors", true);
+
+    DataArrayPath exactColorsPath(k_FeatureIdsPath.getDataContainerName(), k_FeatureIdsPath.getAttributeMatrixName(), "ExactColors");
+    DataArrayPath tableColorsPath(k_FeatureIdsPath.getDataContainerName(), k_FeatureIdsPath.getAttributeMatrixName(), "TableColors");
+    UInt8ArrayType::Pointer exactColors = dca->getPrereqArrayFromPath<UInt8ArrayType>(nullptr, exactColorsPath, {3});
+    UInt8ArrayType::Pointer tableColors = dca->getPrereqArrayFromPath<UInt8ArrayType>(nullptr, tableColorsPath, {3});
+    DREAM3D_REQUIRE_VALID_POINTER(exactColors.get())
+    DREAM3D_REQUIRE_VALID_POINTER(tableColors.get())
+    for(size_t i = 0; i < exactColors->size(); i++)
+    {
+      int32_t error = std::abs(static_cast<int32_t>((*tableColors)[i]) - static_cast<int32_t>((*exactColors)[i]));
+      DREAM3D_REQUIRED(error, <=, 5)
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int32_t TestCubicBlockColors()
+  {
+    // the block colors must match the scalar colors of EbsdLib's disorientation exactly, and stay within the documented
+    // errors with single precision (1) or the lookup table (5)
+    std::mt19937_64 generator(2468);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    const QuatD refQuat(0.1, 0.2, 0.3, std::sqrt(1.0 - 0.14));
+    const size_t numQuats = 100000;
+    std::vector<float> quats(numQuats * 4);
+    for(size_t i = 0; i < numQuats; i++)
+    {
+      // every other orientation is within a few degrees of the reference, where the disorientation is close to the identity
+      float scale = i % 2 == 0 ? 1.0f : 0.02f;
+      QuatD delta(normal(generator) * scale, normal(generator) * scale, normal(generator) * scale, i % 2 == 0 ? normal(generator) : 1.0f);
+      QuatD quat = i % 2 == 0 ? delta : delta * refQuat;
+      double norm = std::sqrt(quat.x() * quat.x() + quat.y() * quat.y() + quat.z() * quat.z() + quat.w() * quat.w());
+      quats[i * 4] = static_cast<float>(quat.x() / norm);
+      quats[i * 4 + 1] = static_cast<float>(quat.y() / norm);
+      quats[i * 4 + 2] = static_cast<float>(quat.z() / norm);
+      quats[i * 4 + 3] = static_cast<float>(quat.w() / norm);
+    }
+
+    // the first block holds disorientations on (within single precision of) the boundary of the fundamental zone, 45
+    // degrees about <100> and 60 degrees about <111>, where two symmetric equivalents (nearly) tie
+    const double k_Sin45Half = std::sin(M_PI / 8.0);
+    const double k_Cos45Half = std::cos(M_PI / 8.0);
+    const double k_Sin60HalfOverSqrt3 = 0.5 / std::sqrt(3.0);
+    const double k_Cos60Half = std::cos(M_PI / 6.0);
+    const std::array<QuatD, 6> boundary = {QuatD(k_Sin45Half, 0.0, 0.0, k_Cos45Half),
+                                           QuatD(0.0, k_Sin45Half, 0.0, k_Cos45Half),
+                                           QuatD(0.0, 0.0, -k_Sin45Half, k_Cos45Half),
+                                           QuatD(k_Sin60HalfOverSqrt3, k_Sin60HalfOverSqrt3, k_Sin60HalfOverSqrt3, k_Cos60Half),
+                                           QuatD(-k_Sin60HalfOverSqrt3, k_Sin60HalfOverSqrt3, k_Sin60HalfOverSqrt3, k_Cos60Half),
+                                           QuatD(0.0, 0.0, 0.0, 1.0)};
+    for(size_t i = 0; i < boundary.size(); i++)
+    {
+      QuatD quat = boundary[i] * refQuat;
+      quats[i * 4] = static_cast<float>(quat.x());
+      quats[i * 4 + 1] = static_cast<float>(quat.y());
+      quats[i * 4 + 2] = static_cast<float>(quat.z());
+      quats[i * 4 + 3] = static_cast<float>(quat.w());
+    }
+
+    CubicOpsMisoColor::Pointer ops = CubicOpsMisoColor::New();
+    std::array<SIMPL::Rgb, CubicOpsMisoColor::k_BlockSize> exact = {};
+    std::array<SIMPL::Rgb, CubicOpsMisoColor::k_BlockSize> fast = {};
+    std::array<SIMPL::Rgb, CubicOpsMisoColor::k_BlockSize> table = {};
+    for(size_t blockStart = 0; blockStart < numQuats; blockStart += CubicOpsMisoColor::k_BlockSize)
+    {
+      size_t count = std::min(CubicOpsMisoColor::k_BlockSize, numQuats - blockStart);
+      const float* block = quats.data() + blockStart * 4;
+      ops->generateMisorientationColors(block, count, refQuat, false, false, exact.data());
+      ops->generateMisorientationColors(block, count, refQuat, false, true, fast.data());
+      ops->generateMisorientationColors(block, count, refQuat, true, false, table.data());
+      for(size_t j = 0; j < count; j++)
+      {
+        SIMPL::Rgb scalar = ops->generateMisorientationColor(QuatD(block[j * 4], block[j * 4 + 1], block[j * 4 + 2], block[j * 4 + 3]), refQuat);
+        DREAM3D_REQUIRE_EQUAL(exact[j], scalar)
+        int32_t fastError = std::max({std::abs(RgbColor::dRed(fast[j]) - RgbColor::dRed(scalar)), std::abs(RgbColor::dGreen(fast[j]) - RgbColor::dGreen(scalar)),
+                                      std::abs(RgbColor::dBlue(fast[j]) - RgbColor::dBlue(scalar))});
+        DREAM3D_REQUIRED(fastError, <=, 1)
+        int32_t tableError = std::max({std::abs(RgbColor::dRed(table[j]) - RgbColor::dRed(scalar)), std::abs(RgbColor::dGreen(table[j]) - RgbColor::dGreen(scalar)),
+                                       std::abs(RgbColor::dBlue(table[j]) - RgbColor::dBlue(scalar))});
+        DREAM3D_REQUIRED(tableError, <=, 5)
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int32_t TestHexagonalFastColors()
+  {
+    // the single precision colors must stay within 1 of the exact colors, also close to the identity and on the branches
+    // of eq. c5.2 (30 degree axis sectors) and c1.6 that single precision can't decide
+    std::mt19937_64 generator(1357);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    const QuatD refQuat(0.1, -0.2, 0.3, std::sqrt(1.0 - 0.14));
+    std::vector<QuatD> quats;
+
+    // rotations about the c axis, about an a axis, about the axis between two a axes and about the axis 15 degrees from
+    // an a axis (the branch of eq. c5.2)
+    const std::array<std::array<double, 3>, 4> axes = {{{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {std::cos(M_PI / 6.0), std::sin(M_PI / 6.0), 0.0}, {std::cos(M_PI / 12.0), std::sin(M_PI / 12.0), 0.0}}};
+    for(const std::array<double, 3>& axis : axes)
+    {
+      for(int32_t degrees = 0; degrees <= 180; degrees++)
+      {
+        double halfAngle = degrees * M_PI / 360.0;
+        quats.push_back(QuatD(axis[0] * std::sin(halfAngle), axis[1] * std::sin(halfAngle), axis[2] * std::sin(halfAngle), std::cos(halfAngle)) * refQuat);
+      }
+    }
+    for(size_t i = 0; i < 100000; i++)
+    {
+      // every other orientation is within a few degrees of the reference, where the disorientation is close to the identity
+      float scale = i % 2 == 0 ? 1.0f : 0.02f;
+      QuatD delta(normal(generator) * scale, normal(generator) * scale, normal(generator) * scale, i % 2 == 0 ? normal(generator) : 1.0f);
+      quats.push_back(i % 2 == 0 ? delta : delta * refQuat);
+    }
+
+    HexagonalOpsMisoColor::Pointer ops = HexagonalOpsMisoColor::New();
+    for(const QuatD& quat : quats)
+    {
+      // single precision orientations, like the filter's input
+      double norm = std::sqrt(quat.x() * quat.x() + quat.y() * quat.y() + quat.z() * quat.z() + quat.w() * quat.w());
+      QuatD q(static_cast<float>(quat.x() / norm), static_cast<float>(quat.y() / norm), static_cast<float>(quat.z() / norm), static_cast<float>(quat.w() / norm));
+      SIMPL::Rgb exact = ops->generateMisorientationColor(q, refQuat);
+      SIMPL::Rgb fast = ops->generateMisorientationColor(q, refQuat, false, true);
+      int32_t fastError = std::max({std::abs(RgbColor::dRed(fast) - RgbColor::dRed(exact)), std::abs(RgbColor::dGreen(fast) - RgbColor::dGreen(exact)),
+                                    std::abs(RgbColor::dBlue(fast) - RgbColor::dBlue(exact))});
+      DREAM3D_REQUIRED(fastError, <=, 1)
+    }
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(TestMisorientationColors())
+    DREAM3D_REGISTER_TEST(TestFastMisorientationColors())
+    DREAM3D_REGISTER_TEST(TestFeatureOrientations())
+    DREAM3D_REGISTER_TEST(TestLookupTables())
+    DREAM3D_REGISTER_TEST(TestCubicBlockColors())
+    DREAM3D_REGISTER_TEST(TestHexagonalFastColors())
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
@@ -17,25 +17,628 @@
 
 #include "FindBoundaryAreas.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
 
 #include "UCSBUtilities/UCSBUtilitiesConstants.h"
 #include "UCSBUtilities/UCSBUtilitiesVersion.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#endif
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
   DataArrayID30 = 30,
   DataArrayID31 = 31,
+  DataArrayID32 = 32,
+  DataArrayID40 = 40,
+};
+
+namespace
+{
+// the faces are split into fixed chunks (independent of the number of threads) so the order of the additions, and therefore
+// the rounding of the sums, is the same for every run
+constexpr size_t k_ChunkSize = 1 << 20;
+// every chunk reduces into its own dense rows of accumulators when the rows are small (up to 128 KiB, cache resident) or take
+// less memory than bucketing the faces by blocks of face features (4 bytes per face)
+constexpr size_t k_DenseRowLimit = 1 << 14;
+constexpr size_t k_MaxBuckets = 1 << 12;
+
+/**
+ * @brief Reductions that can be applied to the selected face arrays, in the order of their accumulators and created arrays
+ */
+enum ReductionOp : size_t
+{
+  Sum = 0,
+  Minimum = 1,
+  Maximum = 2,
+  AreaWeightedMean = 3,
+  NumReductionOps = 4
 };
 
+/**
+ * @brief Suffix of the face feature array created for each reduction of a face array
+ */
+const std::array<QString, NumReductionOps> k_ReductionSuffixes = {"Sum", "Min", "Max", "AreaWeightedMean"};
+
+/**
+ * @brief The ArrayAreas struct reads the area of each face from a precomputed array
+ */
+struct ArrayAreas
+{
+  const double* areas;
+
+  double operator()(size_t i) const
+  {
+    return areas[i];
+  }
+};
+
+/**
+ * @brief The TriangleAreas struct computes the area of each triangle from the shared vertex list (in double precision)
+ * when it is needed, so no per triangle array is created
+ */
+struct TriangleAreas
+{
+  const float* vertices;
+  const MeshIndexType* triangles;
+
+  double operator()(size_t i) const
+  {
+    const float* a = vertices + 3 * triangles[3 * i];
+    const float* b = vertices + 3 * triangles[3 * i + 1];
+    const float* c = vertices + 3 * triangles[3 * i + 2];
+    double ab[3] = {static_cast<double>(b[0]) - a[0], static_cast<double>(b[1]) - a[1], static_cast<double>(b[2]) - a[2]};
+    double ac[3] = {static_cast<double>(c[0]) - a[0], static_cast<double>(c[1]) - a[1], static_cast<double>(c[2]) - a[2]};
+    double cross[3] = {ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0]};
+    return 0.5 * std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+  }
+};
+
+/**
+ * @brief Reads value i of a face array of type T as a double
+ */
+template <typename T>
+double ReadFaceValue(const void* data, size_t i)
+{
+  return static_cast<double>(static_cast<const T*>(data)[i]);
+}
+
+/**
+ * @brief The ReducedFaceArray struct holds a face array to reduce, read through the reader matching its type
+ */
+struct ReducedFaceArray
+{
+  const void* data = nullptr;
+  double (*read)(const void*, size_t) = nullptr;
+  size_t numComponents = 1;
+};
+
+/**
+ * @brief Sets the reader of array if it is a DataArray<T>
+ * @return true if array is a DataArray<T>
+ */
+template <typename T>
+bool FindFaceValueReader(const IDataArray::Pointer& array, ReducedFaceArray& reduced)
+{
+  typename DataArray<T>::Pointer typed = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == typed.get())
+  {
+    return false;
+  }
+  reduced.data = typed->getVoidPointer(0);
+  reduced.read = ReadFaceValue<T>;
+  reduced.numComponents = typed->getNumberOfComponents();
+  return true;
+}
+
+/**
+ * @brief The FaceFeatureReductions class lays out the accumulators of one face feature as a row of doubles: the total area,
+ * the number of faces and, for every component of every face array, one accumulator per enabled reduction. It initializes,
+ * accumulates (one face at a time) and combines (two partial rows) rows, so every reduction is computed in a single pass
+ * over the faces.
+ */
+class FaceFeatureReductions
+{
+public:
+  FaceFeatureReductions(const std::vector<ReducedFaceArray>& arrays, const std::array<bool, NumReductionOps>& enabled)
+  : m_Arrays(arrays)
+  {
+    for(size_t op = 0; op < NumReductionOps; op++)
+    {
+      if(enabled[op])
+      {
+        m_Ops.push_back(op);
+      }
+    }
+    m_Width = 2;
+    for(const ReducedFaceArray& array : m_Arrays)
+    {
+      m_Width += array.numComponents * m_Ops.size();
+    }
+  }
+
+  /**
+   * @brief Number of accumulators per face feature
+   */
+  size_t width() const
+  {
+    return m_Width;
+  }
+
+  void initialize(double* row) const
+  {
+    row[0] = 0.0;
+    row[1] = 0.0;
+    double* accumulator = row + 2;
+    for(const ReducedFaceArray& array : m_Arrays)
+    {
+      for(size_t c = 0; c < array.numComponents; c++)
+      {
+        for(size_t op : m_Ops)
+        {
+          *accumulator++ = Minimum == op ? std::numeric_limits<double>::max() : (Maximum == op ? std::numeric_limits<double>::lowest() : 0.0);
+        }
+      }
+    }
+  }
+
+  void accumulate(double* row, size_t face, double area) const
+  {
+    row[0] += area;
+    row[1] += 1.0;
+    double* accumulator = row + 2;
+    for(const ReducedFaceArray& array : m_Arrays)
+    {
+      for(size_t c = 0; c < array.numComponents; c++)
+      {
+        double value = array.read(array.data, face * array.numComponents + c);
+        for(size_t op : m_Ops)
+        {
+          switch(op)
+          {
+          case Sum:
+            *accumulator += value;
+            break;
+          case Minimum:
+            *accumulator = std::min(*accumulator, value);
+            break;
+          case Maximum:
+            *accumulator = std::max(*accumulator, value);
+            break;
+          default:
+            *accumulator += area * value;
+            break;
+          }
+          accumulator++;
+        }
+      }
+    }
+  }
+
+  void combine(double* row, const double* other) const
+  {
+    row[0] += other[0];
+    row[1] += other[1];
+    size_t i = 2;
+    for(const ReducedFaceArray& array : m_Arrays)
+    {
+      for(size_t c = 0; c < array.numComponents; c++)
+      {
+        for(size_t op : m_Ops)
+        {
+          row[i] = Minimum == op ? std::min(row[i], other[i]) : (Maximum == op ? std::max(row[i], other[i]) : row[i] + other[i]);
+          i++;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Final value of reduction op of component c of face array index (minima and maxima of face features without faces are 0)
+   */
+  double result(const double* row, size_t index, size_t c, size_t op) const
+  {
+    size_t i = 2;
+    for(size_t a = 0; a < index; a++)
+    {
+      i += m_Arrays[a].numComponents * m_Ops.size();
+    }
+    i += c * m_Ops.size() + static_cast<size_t>(std::find(m_Ops.begin(), m_Ops.end(), op) - m_Ops.begin());
+    if(AreaWeightedMean == op)
+    {
+      return row[0] > 0.0 ? row[i] / row[0] : 0.0;
+    }
+    if((Minimum == op || Maximum == op) && 0.0 == row[1])
+    {
+      return 0.0;
+    }
+    return row[i];
+  }
+
+private:
+  std::vector<ReducedFaceArray> m_Arrays;
+  std::vector<size_t> m_Ops;
+  size_t m_Width = 2;
+};
+} // namespace
+
+/**
+ * @brief The ReduceChunksImpl class reduces the faces of each chunk into the chunk's dense rows of accumulators (one row
+ * per face feature). Faces with an out of range face feature id are skipped and flag their chunk.
+ */
+template <typename AreaType>
+class ReduceChunksImpl
+{
+  const FaceFeatureReductions& m_Reductions;
+  AreaType m_Areas;
+  const int32_t* m_FeatureFaceIds;
+  size_t m_NumFaces;
+  size_t m_NumFeatures;
+  double* m_Partials;
+  uint8_t* m_Invalid;
+
+public:
+  ReduceChunksImpl(const FaceFeatureReductions& reductions, AreaType areas, const int32_t* featureFaceIds, size_t numFaces, size_t numFeatures, double* partials, uint8_t* invalid)
+  : m_Reductions(reductions)
+  , m_Areas(areas)
+  , m_FeatureFaceIds(featureFaceIds)
+  , m_NumFaces(numFaces)
+  , m_NumFeatures(numFeatures)
+  , m_Partials(partials)
+  , m_Invalid(invalid)
+  {
+  }
+
+  virtual ~ReduceChunksImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    size_t width = m_Reductions.width();
+    for(size_t chunk = start; chunk < end; chunk++)
+    {
+      double* rows = m_Partials + chunk * m_NumFeatures * width;
+      for(size_t f = 0; f < m_NumFeatures; f++)
+      {
+        m_Reductions.initialize(rows + f * width);
+      }
+      size_t chunkEnd = std::min(m_NumFaces, (chunk + 1) * k_ChunkSize);
+      for(size_t i = chunk * k_ChunkSize; i < chunkEnd; i++)
+      {
+        size_t feature = static_cast<uint32_t>(m_FeatureFaceIds[i]);
+        if(feature >= m_NumFeatures)
+        {
+          m_Invalid[chunk] = 1;
+          continue;
+        }
+        m_Reductions.accumulate(rows + feature * width, i, m_Areas(i));
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The CombineChunksImpl class combines the partial rows of the chunks for a range of face features, always in
+ * chunk order
+ */
+class CombineChunksImpl
+{
+  const FaceFeatureReductions& m_Reductions;
+  const double* m_Partials;
+  size_t m_NumChunks;
+  size_t m_NumFeatures;
+  double* m_Rows;
+
+public:
+  CombineChunksImpl(const FaceFeatureReductions& reductions, const double* partials, size_t numChunks, size_t numFeatures, double* rows)
+  : m_Reductions(reductions)
+  , m_Partials(partials)
+  , m_NumChunks(numChunks)
+  , m_NumFeatures(numFeatures)
+  , m_Rows(rows)
+  {
+  }
+
+  virtual ~CombineChunksImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    size_t width = m_Reductions.width();
+    for(size_t f = start; f < end; f++)
+    {
+      m_Reductions.initialize(m_Rows + f * width);
+    }
+    for(size_t chunk = 0; chunk < m_NumChunks; chunk++)
+    {
+      const double* partials = m_Partials + chunk * m_NumFeatures * width;
+      for(size_t f = start; f < end; f++)
+      {
+        m_Reductions.combine(m_Rows + f * width, partials + f * width);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The BucketFacesImpl class implements the two passes of a threaded, stable counting sort of the faces into
+ * buckets of consecutive face features. The first pass counts the faces of each chunk in each bucket (flagging chunks
+ * with out of range face feature ids), the second scatters the index of each face within its chunk (4 bytes, the face
+ * feature id is read again when the face is reduced) to the offsets of the chunk in each bucket.
+ */
+class BucketFacesImpl
+{
+  const int32_t* m_FeatureFaceIds;
+  size_t m_NumFaces;
+  size_t m_NumFeatures;
+  size_t m_BlockShift;
+  size_t m_NumBuckets;
+  std::vector<size_t>& m_ChunkOffsets;
+  uint8_t* m_Invalid;
+  uint32_t* m_SortedFaces;
+
+public:
+  BucketFacesImpl(const int32_t* featureFaceIds, size_t numFaces, size_t numFeatures, size_t blockShift, size_t numBuckets, std::vector<size_t>& chunkOffsets, uint8_t* invalid, uint32_t* sortedFaces)
+  : m_FeatureFaceIds(featureFaceIds)
+  , m_NumFaces(numFaces)
+  , m_NumFeatures(numFeatures)
+  , m_BlockShift(blockShift)
+  , m_NumBuckets(numBuckets)
+  , m_ChunkOffsets(chunkOffsets)
+  , m_Invalid(invalid)
+  , m_SortedFaces(sortedFaces)
+  {
+  }
+
+  virtual ~BucketFacesImpl() = default;
+
+  /**
+   * @brief Counts (nullptr == sortedFaces) or scatters (chunk offsets already prefix summed) the faces of chunks [start, end)
+   */
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t chunk = start; chunk < end; chunk++)
+    {
+      size_t* offsets = m_ChunkOffsets.data() + chunk * m_NumBuckets;
+      size_t chunkStart = chunk * k_ChunkSize;
+      size_t chunkEnd = std::min(m_NumFaces, chunkStart + k_ChunkSize);
+      for(size_t i = chunkStart; i < chunkEnd; i++)
+      {
+        size_t feature = static_cast<uint32_t>(m_FeatureFaceIds[i]);
+        if(feature >= m_NumFeatures)
+        {
+          m_Invalid[chunk] = 1;
+          continue;
+        }
+        size_t position = offsets[feature >> m_BlockShift]++;
+        if(nullptr != m_SortedFaces)
+        {
+          m_SortedFaces[position] = static_cast<uint32_t>(i - chunkStart);
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The ReduceBucketsImpl class reduces the bucketed faces of a range of buckets. Buckets hold disjoint face features
+ * and keep the original face order (so the faces are also read in increasing order), so every accumulator is updated
+ * exactly like a serial loop over the faces. The faces of a bucket are grouped by chunk, chunk c ending at the scattered
+ * offset of chunk c in the bucket.
+ */
+template <typename AreaType>
+class ReduceBucketsImpl
+{
+  const FaceFeatureReductions& m_Reductions;
+  AreaType m_Areas;
+  const int32_t* m_FeatureFaceIds;
+  const uint32_t* m_SortedFaces;
+  const std::vector<size_t>& m_BucketOffsets;
+  const std::vector<size_t>& m_ChunkOffsets;
+  size_t m_NumChunks;
+  double* m_Rows;
+
+public:
+  ReduceBucketsImpl(const FaceFeatureReductions& reductions, AreaType areas, const int32_t* featureFaceIds, const uint32_t* sortedFaces, const std::vector<size_t>& bucketOffsets,
+                    const std::vector<size_t>& chunkOffsets, size_t numChunks, double* rows)
+  : m_Reductions(reductions)
+  , m_Areas(areas)
+  , m_FeatureFaceIds(featureFaceIds)
+  , m_SortedFaces(sortedFaces)
+  , m_BucketOffsets(bucketOffsets)
+  , m_ChunkOffsets(chunkOffsets)
+  , m_NumChunks(numChunks)
+  , m_Rows(rows)
+  {
+  }
+
+  virtual ~ReduceBucketsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    size_t width = m_Reductions.width();
+    size_t numBuckets = m_BucketOffsets.size() - 1;
+    for(size_t b = start; b < end; b++)
+    {
+      size_t i = m_BucketOffsets[b];
+      for(size_t chunk = 0; chunk < m_NumChunks; chunk++)
+      {
+        size_t chunkStart = chunk * k_ChunkSize;
+        for(size_t chunkEnd = m_ChunkOffsets[chunk * numBuckets + b]; i < chunkEnd; i++)
+        {
+          size_t face = chunkStart + m_SortedFaces[i];
+          m_Reductions.accumulate(m_Rows + static_cast<size_t>(m_FeatureFaceIds[face]) * width, face, m_Areas(face));
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+namespace
+{
+/**
+ * @brief Reduces every face (with area areas(i)) into the row of accumulators of its face feature in a thread count
+ * independent order
+ * @param rows numFeatures rows of reductions.width() accumulators
+ * @return true if some faces were skipped because their face feature id is out of range
+ */
+template <typename AreaType>
+bool ReduceFaceFeatures(const FaceFeatureReductions& reductions, const AreaType& areas, const int32_t* featureFaceIds, size_t numFaces, size_t numFeatures, double* rows)
+{
+  size_t width = reductions.width();
+  size_t numChunks = (numFaces + k_ChunkSize - 1) / k_ChunkSize;
+  std::vector<uint8_t> invalid(numChunks, 0);
+
+  if(numFeatures * width <= k_DenseRowLimit || numChunks * numFeatures * width <= numFaces / 2)
+  {
+    // few face features: reduce each chunk into its own rows, then combine the rows in chunk order
+    std::vector<double> partials(numChunks * numFeatures * width);
+    ReduceChunksImpl<AreaType> reduceImpl(reductions, areas, featureFaceIds, numFaces, numFeatures, partials.data(), invalid.data());
+    CombineChunksImpl combineImpl(reductions, partials.data(), numChunks, numFeatures, rows);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), reduceImpl, tbb::auto_partitioner());
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures, 1024), combineImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      reduceImpl.generate(0, numChunks);
+      combineImpl.generate(0, numFeatures);
+    }
+    return std::find(invalid.begin(), invalid.end(), 1) != invalid.end();
+  }
+
+  // many face features: bucketing only reproduces the order of a serial loop over the faces, so a single thread runs that loop
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    reductions.initialize(rows + f * width);
+  }
+  bool serial = true;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  serial = tbb::this_task_arena::max_concurrency() < 2;
+#endif
+  if(serial)
+  {
+    bool skipped = false;
+    for(size_t i = 0; i < numFaces; i++)
+    {
+      size_t feature = static_cast<uint32_t>(featureFaceIds[i]);
+      if(feature >= numFeatures)
+      {
+        skipped = true;
+        continue;
+      }
+      reductions.accumulate(rows + feature * width, i, areas(i));
+    }
+    return skipped;
+  }
+
+  // otherwise stable counting sort of the faces into blocks of face features, then reduce each block's faces in order
+  size_t blockShift = 0;
+  while(((numFeatures - 1) >> blockShift) >= k_MaxBuckets)
+  {
+    blockShift++;
+  }
+  size_t numBuckets = ((numFeatures - 1) >> blockShift) + 1;
+  std::vector<size_t> chunkOffsets(numChunks * numBuckets, 0);
+  BucketFacesImpl countImpl(featureFaceIds, numFaces, numFeatures, blockShift, numBuckets, chunkOffsets, invalid.data(), nullptr);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), countImpl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    countImpl.generate(0, numChunks);
+  }
+
+  // bucket major prefix sum: the faces of a bucket are ordered by chunk, then by index within the chunk
+  std::vector<size_t> bucketOffsets(numBuckets + 1, 0);
+  size_t total = 0;
+  for(size_t b = 0; b < numBuckets; b++)
+  {
+    bucketOffsets[b] = total;
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      size_t count = chunkOffsets[chunk * numBuckets + b];
+      chunkOffsets[chunk * numBuckets + b] = total;
+      total += count;
+    }
+  }
+  bucketOffsets[numBuckets] = total;
+
+  std::vector<uint32_t> sortedFaces(total);
+  BucketFacesImpl scatterImpl(featureFaceIds, numFaces, numFeatures, blockShift, numBuckets, chunkOffsets, invalid.data(), sortedFaces.data());
+  ReduceBucketsImpl<AreaType> reduceImpl(reductions, areas, featureFaceIds, sortedFaces.data(), bucketOffsets, chunkOffsets, numChunks, rows);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), scatterImpl, tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBuckets), reduceImpl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    scatterImpl.generate(0, numChunks);
+    reduceImpl.generate(0, numBuckets);
+  }
+  return std::find(invalid.begin(), invalid.end(), 1) != invalid.end();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -53,19 +656,48 @@ void FindBoundaryAreas::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
 
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Area Source");
+    parameter->setPropertyName("AreaSource");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(FindBoundaryAreas, this, AreaSource));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(FindBoundaryAreas, this, AreaSource));
+    parameter->setDefaultValue(getAreaSource());
+    std::vector<QString> choices = {"Triangle Areas Array", "Triangle Geometry"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedChoiceProps = {"SurfaceMeshTriangleAreasArrayPath"};
+    parameter->setLinkedProperties(linkedChoiceProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+
   {
     DataArraySelectionFilterParameter::RequirementType req;
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Triangle Areas", SurfaceMeshTriangleAreasArrayPath, FilterParameter::Category::RequiredArray, FindBoundaryAreas, req));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Triangle Areas", SurfaceMeshTriangleAreasArrayPath, FilterParameter::Category::RequiredArray, FindBoundaryAreas, req, 0));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Face Feature Ids", SurfaceMeshFeatureFaceIdsArrayPath, FilterParameter::Category::RequiredArray, FindBoundaryAreas, req));
   }
+  {
+    MultiDataArraySelectionFilterParameter::RequirementType req =
+        MultiDataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Category::Element);
+    parameters.push_back(SIMPL_NEW_MDA_SELECTION_FP("Face Arrays to Reduce", SelectedFaceArrayPaths, FilterParameter::Category::RequiredArray, FindBoundaryAreas, req));
+  }
+
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Sum", ComputeSums, FilterParameter::Category::Parameter, FindBoundaryAreas));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Minimum", ComputeMinima, FilterParameter::Category::Parameter, FindBoundaryAreas));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Maximum", ComputeMaxima, FilterParameter::Category::Parameter, FindBoundaryAreas));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Area Weighted Mean", ComputeAreaWeightedMeans, FilterParameter::Category::Parameter, FindBoundaryAreas));
+  std::vector<QString> linkedProps = {"TriangleCountsArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Count Triangles", ComputeTriangleCounts, FilterParameter::Category::Parameter, FindBoundaryAreas, linkedProps));
 
   {
     DataArrayCreationFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Boundary Areas Array", SurfaceMeshBoundaryAreasArrayPath, FilterParameter::Category::CreatedArray, FindBoundaryAreas, req));
   }
+  parameters.push_back(SIMPL_NEW_STRING_FP("Triangle Counts", TriangleCountsArrayName, FilterParameter::Category::CreatedArray, FindBoundaryAreas));
 
   setFilterParameters(parameters);
 }
@@ -79,6 +711,14 @@ void FindBoundaryAreas::readFilterParameters(AbstractFilterParametersReader* rea
   setSurfaceMeshBoundaryAreasArrayPath(reader->readDataArrayPath("SurfaceMeshBoundaryAreasArrayPath", getSurfaceMeshBoundaryAreasArrayPath()));
   setSurfaceMeshFeatureFaceIdsArrayPath(reader->readDataArrayPath("SurfaceMeshFeatureFaceIdsArrayPath", getSurfaceMeshFeatureFaceIdsArrayPath()));
   setSurfaceMeshTriangleAreasArrayPath(reader->readDataArrayPath("SurfaceMeshTriangleAreasArrayPath", getSurfaceMeshTriangleAreasArrayPath()));
+  setAreaSource(reader->readValue("AreaSource", getAreaSource()));
+  setSelectedFaceArrayPaths(reader->readDataArrayPathVector("SelectedFaceArrayPaths", getSelectedFaceArrayPaths()));
+  setComputeSums(reader->readValue("ComputeSums", getComputeSums()));
+  setComputeMinima(reader->readValue("ComputeMinima", getComputeMinima()));
+  setComputeMaxima(reader->readValue("ComputeMaxima", getComputeMaxima()));
+  setComputeAreaWeightedMeans(reader->readValue("ComputeAreaWeightedMeans", getComputeAreaWeightedMeans()));
+  setComputeTriangleCounts(reader->readValue("ComputeTriangleCounts", getComputeTriangleCounts()));
+  setTriangleCountsArrayName(reader->readString("TriangleCountsArrayName", getTriangleCountsArrayName()));
   reader->closeFilterGroup();
 }
 
@@ -104,17 +744,73 @@ void FindBoundaryAreas::dataCheck()
     m_SurfaceMeshFeatureFaceIds = m_SurfaceMeshFeatureFaceIdsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
-  m_SurfaceMeshTriangleAreasPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<double>>(this, getSurfaceMeshTriangleAreasArrayPath(), dims);
-  if(nullptr != m_SurfaceMeshTriangleAreasPtr.lock())
+  if(0 == getAreaSource())
   {
-    m_SurfaceMeshTriangleAreas = m_SurfaceMeshTriangleAreasPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    m_SurfaceMeshTriangleAreasPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<double>>(this, getSurfaceMeshTriangleAreasArrayPath(), dims);
+    if(nullptr != m_SurfaceMeshTriangleAreasPtr.lock())
+    {
+      m_SurfaceMeshTriangleAreas = m_SurfaceMeshTriangleAreasPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+  else
+  {
+    // the areas are computed from the triangle geometry of the face feature ids, no per triangle array is read
+    getDataContainerArray()->getPrereqGeometryFromDataContainer<TriangleGeom>(this, getSurfaceMeshFeatureFaceIdsArrayPath().getDataContainerName());
+  }
 
   m_SurfaceMeshBoundaryAreasPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, getSurfaceMeshBoundaryAreasArrayPath(), 0.0, dims, "", DataArrayID31);
   if(nullptr != m_SurfaceMeshBoundaryAreasPtr.lock())
   {
     m_SurfaceMeshBoundaryAreas = m_SurfaceMeshBoundaryAreasPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  DataArrayPath tempPath;
+  if(getComputeTriangleCounts())
+  {
+    tempPath.update(getSurfaceMeshBoundaryAreasArrayPath().getDataContainerName(), getSurfaceMeshBoundaryAreasArrayPath().getAttributeMatrixName(), getTriangleCountsArrayName());
+    m_TriangleCountsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID32);
+    if(nullptr != m_TriangleCountsPtr.lock())
+    {
+      m_TriangleCounts = m_TriangleCountsPtr.lock()->getPointer(0);
+    }
+  }
+
+  // every selected face array gets one face feature array (with its components) per selected reduction
+  std::array<bool, NumReductionOps> enabled = {getComputeSums(), getComputeMinima(), getComputeMaxima(), getComputeAreaWeightedMeans()};
+  m_SelectedFaceArrays.clear();
+  m_ReducedArraysPtrs.clear();
+  if(!getSelectedFaceArrayPaths().empty() && std::find(enabled.begin(), enabled.end(), true) == enabled.end())
+  {
+    setErrorCondition(-4, "Select at least one reduction (sum, minimum, maximum or area weighted mean) for the face arrays");
+    return;
+  }
+  for(size_t i = 0; i < getSelectedFaceArrayPaths().size(); i++)
+  {
+    const DataArrayPath& path = getSelectedFaceArrayPaths()[i];
+    IDataArray::Pointer array = getDataContainerArray()->getPrereqIDataArrayFromPath(this, path);
+    if(nullptr == array.get())
+    {
+      continue;
+    }
+    if(!path.hasSameAttributeMatrixPath(getSurfaceMeshFeatureFaceIdsArrayPath()))
+    {
+      QString ss = QObject::tr("The face array %1 must belong to the same DataContainer / AttributeMatrix as the Face Feature Ids").arg(path.getDataArrayName());
+      setErrorCondition(-3, ss);
+      continue;
+    }
+    m_SelectedFaceArrays.push_back(array);
+
+    std::vector<size_t> cDims = array->getComponentDimensions();
+    for(size_t op = 0; op < NumReductionOps; op++)
+    {
+      if(enabled[op])
+      {
+        tempPath.update(getSurfaceMeshBoundaryAreasArrayPath().getDataContainerName(), getSurfaceMeshBoundaryAreasArrayPath().getAttributeMatrixName(), path.getDataArrayName() + k_ReductionSuffixes[op]);
+        m_ReducedArraysPtrs.push_back(
+            getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, tempPath, 0.0, cDims, "", static_cast<RenameDataPath::DataID_t>(DataArrayID40 + NumReductionOps * i + op)));
+      }
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -128,20 +824,87 @@ void FindBoundaryAreas::execute()
     return;
   }
 
+  // the selected face arrays are read in their own type
+  std::vector<ReducedFaceArray> arrays;
+  for(const std::weak_ptr<IDataArray>& weakArray : m_SelectedFaceArrays)
+  {
+    IDataArray::Pointer array = weakArray.lock();
+    ReducedFaceArray reduced;
+    bool supported = FindFaceValueReader<float>(array, reduced) || FindFaceValueReader<double>(array, reduced) || FindFaceValueReader<int8_t>(array, reduced) ||
+                     FindFaceValueReader<uint8_t>(array, reduced) || FindFaceValueReader<int16_t>(array, reduced) || FindFaceValueReader<uint16_t>(array, reduced) ||
+                     FindFaceValueReader<int32_t>(array, reduced) || FindFaceValueReader<uint32_t>(array, reduced) || FindFaceValueReader<int64_t>(array, reduced) ||
+                     FindFaceValueReader<uint64_t>(array, reduced) || FindFaceValueReader<bool>(array, reduced);
+    if(!supported)
+    {
+      QString ss = QObject::tr("Face arrays of type %1 are not supported").arg(array->getTypeAsString());
+      setErrorCondition(-5, ss);
+      return;
+    }
+    arrays.push_back(reduced);
+  }
+  std::array<bool, NumReductionOps> enabled = {getComputeSums(), getComputeMinima(), getComputeMaxima(), getComputeAreaWeightedMeans()};
+  FaceFeatureReductions reductions(arrays, enabled);
+
   // get number of face features
-  size_t numFaces = m_SurfaceMeshTriangleAreasPtr.lock()->getNumberOfTuples();
+  size_t numFaces = m_SurfaceMeshFeatureFaceIdsPtr.lock()->getNumberOfTuples();
   size_t numFeatures = m_SurfaceMeshBoundaryAreasPtr.lock()->getNumberOfTuples();
+  size_t width = reductions.width();
+  std::vector<double> rows(numFeatures * width);
+  bool skipped = false;
+  if(0 == getAreaSource())
+  {
+    ArrayAreas areas = {m_SurfaceMeshTriangleAreas};
+    skipped = ReduceFaceFeatures(reductions, areas, m_SurfaceMeshFeatureFaceIds, numFaces, numFeatures, rows.data());
+  }
+  else
+  {
+    TriangleGeom::Pointer triangles = getDataContainerArray()->getDataContainer(getSurfaceMeshFeatureFaceIdsArrayPath().getDataContainerName())->getGeometryAs<TriangleGeom>();
+    if(triangles->getNumberOfTris() != numFaces)
+    {
+      QString ss = QObject::tr("The Face Feature Ids have %1 tuples but the triangle geometry has %2 triangles").arg(numFaces).arg(triangles->getNumberOfTris());
+      setErrorCondition(-2, ss);
+      return;
+    }
+    TriangleAreas areas = {triangles->getVertexPointer(0), triangles->getTriPointer(0)};
+    skipped = ReduceFaceFeatures(reductions, areas, m_SurfaceMeshFeatureFaceIds, numFaces, numFeatures, rows.data());
+  }
 
-  // initialize all areas as 0
-  for(size_t i = 0; i < numFeatures; i++)
+  // copy the accumulators to the created arrays
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    m_SurfaceMeshBoundaryAreas[f] = rows[f * width];
+  }
+  if(getComputeTriangleCounts())
   {
-    m_SurfaceMeshBoundaryAreas[i] = 0.0;
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      m_TriangleCounts[f] = static_cast<int32_t>(rows[f * width + 1]);
+    }
+  }
+  size_t output = 0;
+  for(size_t a = 0; a < arrays.size(); a++)
+  {
+    for(size_t op = 0; op < NumReductionOps; op++)
+    {
+      if(!enabled[op])
+      {
+        continue;
+      }
+      double* reduced = m_ReducedArraysPtrs[output++].lock()->getPointer(0);
+      for(size_t f = 0; f < numFeatures; f++)
+      {
+        for(size_t c = 0; c < arrays[a].numComponents; c++)
+        {
+          reduced[f * arrays[a].numComponents + c] = reductions.result(rows.data() + f * width, a, c, op);
+        }
+      }
+    }
   }
 
-  // loop over faces accumulating area
-  for(size_t i = 0; i < numFaces; i++)
+  if(skipped)
   {
-    m_SurfaceMeshBoundaryAreas[m_SurfaceMeshFeatureFaceIds[i]] += m_SurfaceMeshTriangleAreas[i];
+    QString ss = QObject::tr("Some Face Feature Ids are outside of the %1 tuples of the Boundary Areas attribute matrix, their faces were skipped").arg(numFeatures);
+    setWarningCondition(-1, ss);
   }
 }
 
@@ -280,3 +1043,99 @@ DataArrayPath FindBoundaryAreas::getSurfaceMeshBoundaryAreasArrayPath() const
 {
   return m_SurfaceMeshBoundaryAreasArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setAreaSource(int value)
+{
+  m_AreaSource = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindBoundaryAreas::getAreaSource() const
+{
+  return m_AreaSource;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setSelectedFaceArrayPaths(const std::vector<DataArrayPath>& value)
+{
+  m_SelectedFaceArrayPaths = value;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> FindBoundaryAreas::getSelectedFaceArrayPaths() const
+{
+  return m_SelectedFaceArrayPaths;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setComputeSums(bool value)
+{
+  m_ComputeSums = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindBoundaryAreas::getComputeSums() const
+{
+  return m_ComputeSums;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setComputeMinima(bool value)
+{
+  m_ComputeMinima = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindBoundaryAreas::getComputeMinima() const
+{
+  return m_ComputeMinima;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setComputeMaxima(bool value)
+{
+  m_ComputeMaxima = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindBoundaryAreas::getComputeMaxima() const
+{
+  return m_ComputeMaxima;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setComputeAreaWeightedMeans(bool value)
+{
+  m_ComputeAreaWeightedMeans = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindBoundaryAreas::getComputeAreaWeightedMeans() const
+{
+  return m_ComputeAreaWeightedMeans;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setComputeTriangleCounts(bool value)
+{
+  m_ComputeTriangleCounts = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindBoundaryAreas::getComputeTriangleCounts() const
+{
+  return m_ComputeTriangleCounts;
+}
+
+// -----------------------------------------------------------------------------
+void FindBoundaryAreas::setTriangleCountsArrayName(const QString& value)
+{
+  m_TriangleCountsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindBoundaryAreas::getTriangleCountsArrayName() const
+{
+  return m_TriangleCountsArrayName;
+}
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -47,6 +48,14 @@ class UCSBUtilities_EXPORT FindBoundaryAreas : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SurfaceMeshTriangleAreasArrayPath READ getSurfaceMeshTriangleAreasArrayPath WRITE setSurfaceMeshTriangleAreasArrayPath)
   PYB11_PROPERTY(DataArrayPath SurfaceMeshFeatureFaceIdsArrayPath READ getSurfaceMeshFeatureFaceIdsArrayPath WRITE setSurfaceMeshFeatureFaceIdsArrayPath)
   PYB11_PROPERTY(DataArrayPath SurfaceMeshBoundaryAreasArrayPath READ getSurfaceMeshBoundaryAreasArrayPath WRITE setSurfaceMeshBoundaryAreasArrayPath)
+  PYB11_PROPERTY(int AreaSource READ getAreaSource WRITE setAreaSource)
+  PYB11_PROPERTY(std::vector<DataArrayPath> SelectedFaceArrayPaths READ getSelectedFaceArrayPaths WRITE setSelectedFaceArrayPaths)
+  PYB11_PROPERTY(bool ComputeSums READ getComputeSums WRITE setComputeSums)
+  PYB11_PROPERTY(bool ComputeMinima READ getComputeMinima WRITE setComputeMinima)
+  PYB11_PROPERTY(bool ComputeMaxima READ getComputeMaxima WRITE setComputeMaxima)
+  PYB11_PROPERTY(bool ComputeAreaWeightedMeans READ getComputeAreaWeightedMeans WRITE setComputeAreaWeightedMeans)
+  PYB11_PROPERTY(bool ComputeTriangleCounts READ getComputeTriangleCounts WRITE setComputeTriangleCounts)
+  PYB11_PROPERTY(QString TriangleCountsArrayName READ getTriangleCountsArrayName WRITE setTriangleCountsArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -109,6 +118,102 @@ public:
 
   Q_PROPERTY(DataArrayPath SurfaceMeshBoundaryAreasArrayPath READ getSurfaceMeshBoundaryAreasArrayPath WRITE setSurfaceMeshBoundaryAreasArrayPath)
 
+  /**
+   * @brief Setter property for AreaSource
+   */
+  void setAreaSource(int value);
+  /**
+   * @brief Getter property for AreaSource
+   * @return Value of AreaSource
+   */
+  int getAreaSource() const;
+
+  Q_PROPERTY(int AreaSource READ getAreaSource WRITE setAreaSource)
+
+  /**
+   * @brief Setter property for SelectedFaceArrayPaths
+   */
+  void setSelectedFaceArrayPaths(const std::vector<DataArrayPath>& value);
+  /**
+   * @brief Getter property for SelectedFaceArrayPaths
+   * @return Value of SelectedFaceArrayPaths
+   */
+  std::vector<DataArrayPath> getSelectedFaceArrayPaths() const;
+
+  Q_PROPERTY(std::vector<DataArrayPath> SelectedFaceArrayPaths READ getSelectedFaceArrayPaths WRITE setSelectedFaceArrayPaths)
+
+  /**
+   * @brief Setter property for ComputeSums
+   */
+  void setComputeSums(bool value);
+  /**
+   * @brief Getter property for ComputeSums
+   * @return Value of ComputeSums
+   */
+  bool getComputeSums() const;
+
+  Q_PROPERTY(bool ComputeSums READ getComputeSums WRITE setComputeSums)
+
+  /**
+   * @brief Setter property for ComputeMinima
+   */
+  void setComputeMinima(bool value);
+  /**
+   * @brief Getter property for ComputeMinima
+   * @return Value of ComputeMinima
+   */
+  bool getComputeMinima() const;
+
+  Q_PROPERTY(bool ComputeMinima READ getComputeMinima WRITE setComputeMinima)
+
+  /**
+   * @brief Setter property for ComputeMaxima
+   */
+  void setComputeMaxima(bool value);
+  /**
+   * @brief Getter property for ComputeMaxima
+   * @return Value of ComputeMaxima
+   */
+  bool getComputeMaxima() const;
+
+  Q_PROPERTY(bool ComputeMaxima READ getComputeMaxima WRITE setComputeMaxima)
+
+  /**
+   * @brief Setter property for ComputeAreaWeightedMeans
+   */
+  void setComputeAreaWeightedMeans(bool value);
+  /**
+   * @brief Getter property for ComputeAreaWeightedMeans
+   * @return Value of ComputeAreaWeightedMeans
+   */
+  bool getComputeAreaWeightedMeans() const;
+
+  Q_PROPERTY(bool ComputeAreaWeightedMeans READ getComputeAreaWeightedMeans WRITE setComputeAreaWeightedMeans)
+
+  /**
+   * @brief Setter property for ComputeTriangleCounts
+   */
+  void setComputeTriangleCounts(bool value);
+  /**
+   * @brief Getter property for ComputeTriangleCounts
+   * @return Value of ComputeTriangleCounts
+   */
+  bool getComputeTriangleCounts() const;
+
+  Q_PROPERTY(bool ComputeTriangleCounts READ getComputeTriangleCounts WRITE setComputeTriangleCounts)
+
+  /**
+   * @brief Setter property for TriangleCountsArrayName
+   */
+  void setTriangleCountsArrayName(const QString& value);
+  /**
+   * @brief Getter property for TriangleCountsArrayName
+   * @return Value of TriangleCountsArrayName
+   */
+  QString getTriangleCountsArrayName() const;
+
+  Q_PROPERTY(QString TriangleCountsArrayName READ getTriangleCountsArrayName WRITE setTriangleCountsArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -189,10 +294,22 @@ private:
   int32_t* m_SurfaceMeshFeatureFaceIds = nullptr;
   std::weak_ptr<DataArray<double>> m_SurfaceMeshBoundaryAreasPtr;
   double* m_SurfaceMeshBoundaryAreas = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_TriangleCountsPtr;
+  int32_t* m_TriangleCounts = nullptr;
+  std::vector<std::weak_ptr<IDataArray>> m_SelectedFaceArrays;
+  std::vector<std::weak_ptr<DataArray<double>>> m_ReducedArraysPtrs;
 
   DataArrayPath m_SurfaceMeshTriangleAreasArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceAreas};
   DataArrayPath m_SurfaceMeshFeatureFaceIdsArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::CellData::FeatureIds};
   DataArrayPath m_SurfaceMeshBoundaryAreasArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceFeatureAttributeMatrixName, "BoundaryAreas"};
+  int m_AreaSource = {0};
+  std::vector<DataArrayPath> m_SelectedFaceArrayPaths;
+  bool m_ComputeSums = {false};
+  bool m_ComputeMinima = {false};
+  bool m_ComputeMaxima = {false};
+  bool m_ComputeAreaWeightedMeans = {false};
+  bool m_ComputeTriangleCounts = {false};
+  QString m_TriangleCountsArrayName = {"NumTriangles"};
 
 public:
   FindBoundaryAreas(const FindBoundaryAreas&) = delete;            // Copy Constructor Not Implemented
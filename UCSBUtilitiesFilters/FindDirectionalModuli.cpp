@@ -17,13 +17,21 @@
 
 #include "FindDirectionalModuli.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <numeric>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -32,6 +40,7 @@
 
 #include "UCSBUtilities/UCSBUtilitiesConstants.h"
 #include "UCSBUtilities/UCSBUtilitiesVersion.h"
+#include "UCSBUtilitiesFilters/util/DirectionalModulusKernels.h"
 
 #include <Eigen/Dense>
 #include <Eigen/StdVector>
@@ -42,11 +51,394 @@
 #include "EbsdLib/LaueOps/LaueOps.h"
 #include "EbsdLib/LaueOps/OrthoRhombicOps.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
   DataArrayID30 = 30,
   DataArrayID31 = 31,
+  DataArrayID33 = 33,
+  DataArrayID34 = 34,
+  DataArrayID35 = 35,
+  DataArrayID36 = 36,
+  DataArrayID37 = 37,
+  DataArrayID38 = 38,
+};
+
+namespace
+{
+constexpr size_t k_ChunkSize = 1 << 22;                                     // tuples evaluated between progress updates / cancel checks
+constexpr size_t k_GrainSize = 64 * DirectionalModulusKernels::k_BlockSize; // smallest range handed to a thread
+
+/**
+ * @brief Determines a rotation that aligns a loading direction with the sample 100 direction
+ * @param sampleLoading Loading direction in the sample frame (normalized in place)
+ * @return Rotation as a quaternion
+ */
+QuatF FindLoadingRotation(float sampleLoading[3])
+{
+  QuatF q2;
+  MatrixMath::Normalize3x1(sampleLoading);
+
+  if(sampleLoading[0] >= 1.0f - std::numeric_limits<float>::epsilon())
+  {
+    // already 100 aligned
+    q2 = QuatF::identity();
+  }
+  else if(sampleLoading[0] <= -1.0f + std::numeric_limits<float>::epsilon())
+  {
+    //-100 aligned (rotate 180 deg about any non 100 axis)
+    q2[0] = 0.0f;
+    q2[1] = 0.0f;
+    q2[2] = 1.0f;
+    q2[3] = 0.0f;
+  }
+  else
+  {
+    // not a special case, get appropriate quaternion manually
+    /* for two unit vectors u and v the quaternion defining the rotation (u -> v)
+     *  n = u x v
+     *  q[0] = n[0]
+     *  q[1] = n[1]
+     *  q[2] = n[2]
+     *  q.w = 1 + u.v
+     *  normalize q
+     */
+    q2[0] = 0.0f;
+    q2[1] = sampleLoading[2];
+    q2[2] = -sampleLoading[1];
+    q2[3] = 1.0f + sampleLoading[0];
+    q2 = q2.unitQuaternion();
+  }
+  return q2;
+}
+
+/**
+ * @brief Expresses a loading rotation as the linear map applied to a crystal orientation (qTotal = q2 q1 == L q1). The
+ * first row of the orientation matrix of qTotal is then g^T d, the loading direction d in the crystal frame with the same
+ * convention as the sample compliances (the rows of g are the sample axes in the crystal frame). The product is written
+ * out explicitly instead of relying on the order of QuatF's operator*.
+ * @param q2 Loading rotation
+ * @return Product matrix of the loading rotation
+ */
+DirectionalModulusKernels::QuaternionProductMatrix LoadingRotationMatrix(const QuatF& q2)
+{
+  const float x = q2[0];
+  const float y = q2[1];
+  const float z = q2[2];
+  const float w = q2[3];
+  // rows are the x, y, z and w components of q2 q1 as linear combinations of (x1, y1, z1, w1)
+  return {w, -z, y, x, z, w, -x, y, -y, x, w, z, -x, -y, -z, w};
+}
+
+/**
+ * @brief Mixes a value into a fingerprint. Each step is a bijection of the previous fingerprint (splitmix64 finalizer)
+ * so changing any single value always changes the fingerprint
+ * @param fingerprint Fingerprint so far
+ * @param value Value to mix in
+ * @return Updated fingerprint
+ */
+uint64_t MixFingerprint(uint64_t fingerprint, uint64_t value)
+{
+  uint64_t z = fingerprint ^ value;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/**
+ * @brief Mixes the bit patterns of floats into a fingerprint (pairs of floats per step)
+ * @param fingerprint Fingerprint so far
+ * @param values Values to mix in
+ * @param count Number of values
+ * @return Updated fingerprint
+ */
+uint64_t FloatFingerprint(uint64_t fingerprint, const float* values, size_t count)
+{
+  for(size_t i = 0; i < count; i += 2)
+  {
+    uint32_t bits[2] = {0, 0};
+    std::memcpy(bits, values + i, std::min<size_t>(2, count - i) * sizeof(float));
+    fingerprint = MixFingerprint(fingerprint, (static_cast<uint64_t>(bits[1]) << 32) | bits[0]);
+  }
+  return fingerprint;
+}
+} // namespace
+
+/**
+ * @brief The FindDirectionalModuliImpl class implements a threaded algorithm that computes the directional
+ * moduli of each feature (or element) for one or more loading directions. Orientations are processed in blocks that are transposed
+ * to structure of arrays form so that each kernel evaluates a whole block with the compliances of a single phase. The
+ * kernel is selected once per phase from the symmetry of its compliance matrix. The extremal moduli of each phase are found
+ * before hand, only the rotation of their crystal directions into the sample frame is done per orientation. Shear moduli and
+ * Poisson's ratios reuse the crystal frame loading directions of the moduli.
+ */
+class FindDirectionalModuliImpl
+{
+  using ComplianceCoefficients = DirectionalModulusKernels::ComplianceCoefficients;
+  using QuaternionProductMatrix = DirectionalModulusKernels::QuaternionProductMatrix;
+  using ElasticSymmetry = DirectionalModulusKernels::ElasticSymmetry;
+
+  int32_t* m_Phases;
+  float* m_Quats;
+  unsigned int* m_CrystalStructures;
+  const std::vector<ComplianceCoefficients>& m_Coefficients;
+  const std::vector<ElasticSymmetry>& m_Symmetries;
+  const std::vector<QuaternionProductMatrix>& m_LoadingRotations;
+  const std::vector<QuaternionProductMatrix>& m_TransverseRotations;
+  float* m_DirectionalModuli;
+  float* m_CrystalCompliances;
+  float* m_SampleCompliances;
+  const std::vector<DirectionalModulusKernels::ExtremalModuli>& m_Extremal;
+  float* m_ExtremalModuli;
+  float* m_ExtremalDirections;
+  float* m_AnisotropyRatios;
+  float* m_ShearModuli;
+  float* m_PoissonRatios;
+
+  /**
+   * @brief Evaluates a block of crystal frame directions with the kernel specialized for a phase
+   */
+  void evaluatePhase(int32_t phase, const float* a, const float* b, const float* c, size_t count, float* moduli) const
+  {
+    DirectionalModulusKernels::SymmetryModuli(m_Symmetries[phase], a, b, c, count, m_Coefficients[phase], moduli);
+  }
+
+public:
+  FindDirectionalModuliImpl(int32_t* phases, float* quats, unsigned int* crystalStructures, const std::vector<ComplianceCoefficients>& coefficients,
+                            const std::vector<ElasticSymmetry>& symmetries,
+                            const std::vector<QuaternionProductMatrix>& loadingRotations, float* moduli, float* compliances, float* sampleCompliances,
+                            const std::vector<DirectionalModulusKernels::ExtremalModuli>& extremal, float* extremalModuli, float* extremalDirections, float* anisotropyRatios,
+                            const std::vector<QuaternionProductMatrix>& transverseRotations, float* shearModuli, float* poissonRatios)
+  : m_Phases(phases)
+  , m_Quats(quats)
+  , m_CrystalStructures(crystalStructures)
+  , m_Coefficients(coefficients)
+  , m_Symmetries(symmetries)
+  , m_LoadingRotations(loadingRotations)
+  , m_TransverseRotations(transverseRotations)
+  , m_DirectionalModuli(moduli)
+  , m_CrystalCompliances(compliances)
+  , m_SampleCompliances(sampleCompliances)
+  , m_Extremal(extremal)
+  , m_ExtremalModuli(extremalModuli)
+  , m_ExtremalDirections(extremalDirections)
+  , m_AnisotropyRatios(anisotropyRatios)
+  , m_ShearModuli(shearModuli)
+  , m_PoissonRatios(poissonRatios)
+  {
+  }
+
+  virtual ~FindDirectionalModuliImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    constexpr size_t k_BlockSize = DirectionalModulusKernels::k_BlockSize;
+    size_t numDirections = m_LoadingRotations.size();
+
+    std::array<float, k_BlockSize> qx;
+    std::array<float, k_BlockSize> qy;
+    std::array<float, k_BlockSize> qz;
+    std::array<float, k_BlockSize> qw;
+    std::array<float, k_BlockSize> a;
+    std::array<float, k_BlockSize> b;
+    std::array<float, k_BlockSize> c;
+    std::array<float, k_BlockSize> moduli;
+    std::array<float, k_BlockSize> x;
+    std::array<float, k_BlockSize> y;
+    std::array<float, k_BlockSize> z;
+    std::array<float, k_BlockSize> shearModuli;
+    std::array<float, k_BlockSize> poissonRatios;
+    std::array<int32_t, k_BlockSize> phases;
+    DirectionalModulusKernels::ComplianceBlock sampleCompliances;
+    std::array<int32_t, k_BlockSize> blockPhases;
+
+    for(size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
+    {
+      size_t count = std::min(k_BlockSize, end - blockStart);
+
+      // transpose the block of orientations and find the (valid) phases present
+      size_t numBlockPhases = 0;
+      for(size_t i = 0; i < count; i++)
+      {
+        const float* avgQuatPtr = m_Quats + 4 * (blockStart + i);
+        qx[i] = avgQuatPtr[0];
+        qy[i] = avgQuatPtr[1];
+        qz[i] = avgQuatPtr[2];
+        qw[i] = avgQuatPtr[3];
+
+        int32_t phase = m_Phases[blockStart + i];
+        if(m_CrystalStructures[phase] >= EbsdLib::CrystalStructure::LaueGroupEnd)
+        {
+          phase = -1; // unknown structure, leave modulus at 0
+        }
+        phases[i] = phase;
+        if(phase >= 0 && std::find(blockPhases.begin(), blockPhases.begin() + numBlockPhases, phase) == blockPhases.begin() + numBlockPhases)
+        {
+          blockPhases[numBlockPhases++] = phase;
+        }
+      }
+
+      float* blockModuli = m_DirectionalModuli + blockStart * numDirections;
+      for(size_t d = 0; d < numDirections; d++)
+      {
+        // concatenate rotation with crystal orientations (determine loading direction in the crystal frame)
+        DirectionalModulusKernels::CrystalDirections(qx.data(), qy.data(), qz.data(), qw.data(), count, m_LoadingRotations[d], a.data(), b.data(), c.data());
+
+        // default to 0
+        for(size_t i = 0; i < count; i++)
+        {
+          blockModuli[i * numDirections + d] = 0.0f;
+        }
+
+        // evaluate the block once per phase and keep the lanes belonging to that phase
+        for(size_t p = 0; p < numBlockPhases; p++)
+        {
+          int32_t phase = blockPhases[p];
+          evaluatePhase(phase, a.data(), b.data(), c.data(), count, moduli.data());
+          for(size_t i = 0; i < count; i++)
+          {
+            if(phases[i] == phase)
+            {
+              blockModuli[i * numDirections + d] = moduli[i];
+            }
+          }
+        }
+
+        // shear modulus and Poisson's ratio from the same crystal frame loading direction and its transverse direction
+        if(nullptr != m_ShearModuli)
+        {
+          float* blockShearModuli = m_ShearModuli + blockStart * numDirections;
+          float* blockPoissonRatios = m_PoissonRatios + blockStart * numDirections;
+          DirectionalModulusKernels::CrystalDirections(qx.data(), qy.data(), qz.data(), qw.data(), count, m_TransverseRotations[d], x.data(), y.data(), z.data());
+          for(size_t i = 0; i < count; i++)
+          {
+            blockShearModuli[i * numDirections + d] = 0.0f;
+            blockPoissonRatios[i * numDirections + d] = 0.0f;
+          }
+          for(size_t p = 0; p < numBlockPhases; p++)
+          {
+            int32_t phase = blockPhases[p];
+            DirectionalModulusKernels::ShearModuliAndPoissonRatios(a.data(), b.data(), c.data(), x.data(), y.data(), z.data(), count, m_CrystalCompliances + 36 * phase, shearModuli.data(),
+                                                                   poissonRatios.data());
+            for(size_t i = 0; i < count; i++)
+            {
+              if(phases[i] == phase)
+              {
+                blockShearModuli[i * numDirections + d] = shearModuli[i];
+                blockPoissonRatios[i * numDirections + d] = poissonRatios[i];
+              }
+            }
+          }
+        }
+      }
+
+      // rotate the full compliance matrix of each phase into the sample frame
+      if(nullptr != m_SampleCompliances)
+      {
+        float* blockCompliances = m_SampleCompliances + blockStart * DirectionalModulusKernels::k_NumCompliances;
+        std::fill(blockCompliances, blockCompliances + count * DirectionalModulusKernels::k_NumCompliances, 0.0f);
+        for(size_t p = 0; p < numBlockPhases; p++)
+        {
+          int32_t phase = blockPhases[p];
+          DirectionalModulusKernels::SampleCompliances(qx.data(), qy.data(), qz.data(), qw.data(), count, m_CrystalCompliances + 36 * phase, sampleCompliances);
+          for(size_t i = 0; i < count; i++)
+          {
+            if(phases[i] == phase)
+            {
+              for(size_t k = 0; k < DirectionalModulusKernels::k_NumCompliances; k++)
+              {
+                blockCompliances[i * DirectionalModulusKernels::k_NumCompliances + k] = sampleCompliances[k][i];
+              }
+            }
+          }
+        }
+      }
+
+      // rotate the crystal directions of each phase's extremal moduli into the sample frame
+      if(nullptr != m_ExtremalModuli)
+      {
+        float* blockModuli = m_ExtremalModuli + 2 * blockStart;
+        float* blockDirections = m_ExtremalDirections + 6 * blockStart;
+        float* blockRatios = m_AnisotropyRatios + blockStart;
+        std::fill(blockModuli, blockModuli + 2 * count, 0.0f);
+        std::fill(blockDirections, blockDirections + 6 * count, 0.0f);
+        std::fill(blockRatios, blockRatios + count, 0.0f);
+        for(size_t p = 0; p < numBlockPhases; p++)
+        {
+          const DirectionalModulusKernels::ExtremalModuli& extremal = m_Extremal[blockPhases[p]];
+          float ratio = extremal.minModulus > 0.0f ? extremal.maxModulus / extremal.minModulus : 0.0f;
+          DirectionalModulusKernels::SampleDirections(qx.data(), qy.data(), qz.data(), qw.data(), count, extremal.minDirection, a.data(), b.data(), c.data());
+          DirectionalModulusKernels::SampleDirections(qx.data(), qy.data(), qz.data(), qw.data(), count, extremal.maxDirection, x.data(), y.data(), z.data());
+          for(size_t i = 0; i < count; i++)
+          {
+            if(phases[i] == blockPhases[p])
+            {
+              blockModuli[2 * i] = extremal.minModulus;
+              blockModuli[2 * i + 1] = extremal.maxModulus;
+              blockDirections[6 * i] = a[i];
+              blockDirections[6 * i + 1] = b[i];
+              blockDirections[6 * i + 2] = c[i];
+              blockDirections[6 * i + 3] = x[i];
+              blockDirections[6 * i + 4] = y[i];
+              blockDirections[6 * i + 5] = z[i];
+              blockRatios[i] = ratio;
+            }
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The FindDirectionalModuliFingerprintImpl class implements a threaded algorithm that fingerprints the inputs of
+ * each feature (or element): its orientation and the fingerprint of its phase.
+ */
+class FindDirectionalModuliFingerprintImpl
+{
+  int32_t* m_Phases;
+  float* m_Quats;
+  const std::vector<uint64_t>& m_PhaseFingerprints;
+  uint64_t* m_Fingerprints;
+
+public:
+  FindDirectionalModuliFingerprintImpl(int32_t* phases, float* quats, const std::vector<uint64_t>& phaseFingerprints, uint64_t* fingerprints)
+  : m_Phases(phases)
+  , m_Quats(quats)
+  , m_PhaseFingerprints(phaseFingerprints)
+  , m_Fingerprints(fingerprints)
+  {
+  }
+
+  virtual ~FindDirectionalModuliFingerprintImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Fingerprints[i] = FloatFingerprint(m_PhaseFingerprints[m_Phases[i]], m_Quats + 4 * i, 4);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
 };
 
 // -----------------------------------------------------------------------------
@@ -57,6 +449,10 @@ FindDirectionalModuli::FindDirectionalModuli()
   m_LoadingDirection[0] = 0.0f;
   m_LoadingDirection[1] = 0.0f;
   m_LoadingDirection[2] = 1.0f;
+
+  m_TransverseDirection[0] = 1.0f;
+  m_TransverseDirection[1] = 0.0f;
+  m_TransverseDirection[2] = 0.0f;
 }
 
 // -----------------------------------------------------------------------------
@@ -72,14 +468,52 @@ void FindDirectionalModuli::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Loading Direction", LoadingDirection, FilterParameter::Category::Parameter, FindDirectionalModuli));
+  std::vector<QString> linkedProps = {"LoadingDirectionsArrayPath"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Multiple Loading Directions", UseLoadingDirectionsArray, FilterParameter::Category::Parameter, FindDirectionalModuli, linkedProps));
+  linkedProps = {"SampleCompliancesArrayName", "CellSampleCompliancesArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compute Sample Frame Compliances", ComputeSampleCompliances, FilterParameter::Category::Parameter, FindDirectionalModuli, linkedProps));
+  linkedProps = {"ExtremalModuliArrayName", "ExtremalDirectionsArrayName", "AnisotropyRatiosArrayName", "CellExtremalModuliArrayName", "CellExtremalDirectionsArrayName",
+                 "CellAnisotropyRatiosArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Extremal Moduli", FindExtremalModuli, FilterParameter::Category::Parameter, FindDirectionalModuli, linkedProps));
+  linkedProps = {"TransverseDirection", "ShearModuliArrayName", "PoissonRatiosArrayName", "CellShearModuliArrayName", "CellPoissonRatiosArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compute Shear Moduli and Poisson's Ratios", ComputeShearAndPoisson, FilterParameter::Category::Parameter, FindDirectionalModuli, linkedProps));
+  parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Transverse Direction", TransverseDirection, FilterParameter::Category::Parameter, FindDirectionalModuli));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Only Recompute Changed Inputs", IncrementalUpdate, FilterParameter::Category::Parameter, FindDirectionalModuli));
+
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Orientation Level");
+    parameter->setPropertyName("OrientationLevel");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(FindDirectionalModuli, this, OrientationLevel));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(FindDirectionalModuli, this, OrientationLevel));
+    parameter->setDefaultValue(getOrientationLevel());
+    std::vector<QString> choices = {"Feature", "Element"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedChoiceProps = {"FeaturePhasesArrayPath", "AvgQuatsArrayPath", "DirectionalModuliArrayName", "SampleCompliancesArrayName", "ExtremalModuliArrayName",
+                                              "ExtremalDirectionsArrayName", "AnisotropyRatiosArrayName", "ShearModuliArrayName", "PoissonRatiosArrayName", "CellPhasesArrayPath", "CellQuatsArrayPath",
+                                              "CellDirectionalModuliArrayName", "CellSampleCompliancesArrayName", "CellExtremalModuliArrayName", "CellExtremalDirectionsArrayName",
+                                              "CellAnisotropyRatiosArrayName", "CellShearModuliArrayName", "CellPoissonRatiosArrayName"};
+    parameter->setLinkedProperties(linkedChoiceProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
 
   {
     DataArraySelectionFilterParameter::RequirementType req;
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("FeaturePhases", FeaturePhasesArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("FeaturePhases", FeaturePhasesArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req, 0));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req;
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("AvgQuats", AvgQuatsArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("AvgQuats", AvgQuatsArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req, 0));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Element);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Phases", CellPhasesArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req, 1));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Category::Element);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Quats", CellQuatsArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req, 1));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req;
@@ -89,9 +523,39 @@ void FindDirectionalModuli::setupFilterParameters()
     DataArraySelectionFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Single Crystal Compliances", CrystalCompliancesArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req));
   }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 3, AttributeMatrix::Category::Any);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Loading Directions", LoadingDirectionsArrayPath, FilterParameter::Category::RequiredArray, FindDirectionalModuli, req));
+  }
 
-  parameters.push_back(
-      SIMPL_NEW_DA_WITH_LINKED_AM_FP("DirectionalModuli", DirectionalModuliArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray, FindDirectionalModuli));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("DirectionalModuli", DirectionalModuliArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("DirectionalModuli", CellDirectionalModuliArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("SampleCompliances", SampleCompliancesArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("SampleCompliances", CellSampleCompliancesArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Extremal Moduli", ExtremalModuliArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Extremal Moduli", CellExtremalModuliArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Extremal Directions", ExtremalDirectionsArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Extremal Directions", CellExtremalDirectionsArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Anisotropy Ratios", AnisotropyRatiosArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Anisotropy Ratios", CellAnisotropyRatiosArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Shear Moduli", ShearModuliArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Shear Moduli", CellShearModuliArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Poisson's Ratios", PoissonRatiosArrayName, FeaturePhasesArrayPath, FeaturePhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 0));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Poisson's Ratios", CellPoissonRatiosArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindDirectionalModuli, 1));
 
   setFilterParameters(parameters);
 }
@@ -103,11 +567,34 @@ void FindDirectionalModuli::readFilterParameters(AbstractFilterParametersReader*
 {
   reader->openFilterGroup(this, index);
   setLoadingDirection(reader->readFloatVec3("LoadingDirection", getLoadingDirection()));
+  setUseLoadingDirectionsArray(reader->readValue("UseLoadingDirectionsArray", getUseLoadingDirectionsArray()));
+  setLoadingDirectionsArrayPath(reader->readDataArrayPath("LoadingDirectionsArrayPath", getLoadingDirectionsArrayPath()));
+  setOrientationLevel(reader->readValue("OrientationLevel", getOrientationLevel()));
+  setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
+  setCellQuatsArrayPath(reader->readDataArrayPath("CellQuatsArrayPath", getCellQuatsArrayPath()));
   setFeaturePhasesArrayPath(reader->readDataArrayPath("FeaturePhasesArrayPath", getFeaturePhasesArrayPath()));
   setAvgQuatsArrayPath(reader->readDataArrayPath("AvgQuatsArrayPath", getAvgQuatsArrayPath()));
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath()));
   setCrystalCompliancesArrayPath(reader->readDataArrayPath("CrystalCompliancesArrayPath", getCrystalCompliancesArrayPath()));
   setDirectionalModuliArrayName(reader->readString("DirectionalModuliArrayName", getDirectionalModuliArrayName()));
+  setCellDirectionalModuliArrayName(reader->readString("CellDirectionalModuliArrayName", getCellDirectionalModuliArrayName()));
+  setComputeSampleCompliances(reader->readValue("ComputeSampleCompliances", getComputeSampleCompliances()));
+  setSampleCompliancesArrayName(reader->readString("SampleCompliancesArrayName", getSampleCompliancesArrayName()));
+  setCellSampleCompliancesArrayName(reader->readString("CellSampleCompliancesArrayName", getCellSampleCompliancesArrayName()));
+  setFindExtremalModuli(reader->readValue("FindExtremalModuli", getFindExtremalModuli()));
+  setExtremalModuliArrayName(reader->readString("ExtremalModuliArrayName", getExtremalModuliArrayName()));
+  setCellExtremalModuliArrayName(reader->readString("CellExtremalModuliArrayName", getCellExtremalModuliArrayName()));
+  setExtremalDirectionsArrayName(reader->readString("ExtremalDirectionsArrayName", getExtremalDirectionsArrayName()));
+  setCellExtremalDirectionsArrayName(reader->readString("CellExtremalDirectionsArrayName", getCellExtremalDirectionsArrayName()));
+  setAnisotropyRatiosArrayName(reader->readString("AnisotropyRatiosArrayName", getAnisotropyRatiosArrayName()));
+  setCellAnisotropyRatiosArrayName(reader->readString("CellAnisotropyRatiosArrayName", getCellAnisotropyRatiosArrayName()));
+  setComputeShearAndPoisson(reader->readValue("ComputeShearAndPoisson", getComputeShearAndPoisson()));
+  setTransverseDirection(reader->readFloatVec3("TransverseDirection", getTransverseDirection()));
+  setShearModuliArrayName(reader->readString("ShearModuliArrayName", getShearModuliArrayName()));
+  setCellShearModuliArrayName(reader->readString("CellShearModuliArrayName", getCellShearModuliArrayName()));
+  setPoissonRatiosArrayName(reader->readString("PoissonRatiosArrayName", getPoissonRatiosArrayName()));
+  setCellPoissonRatiosArrayName(reader->readString("CellPoissonRatiosArrayName", getCellPoissonRatiosArrayName()));
+  setIncrementalUpdate(reader->readValue("IncrementalUpdate", getIncrementalUpdate()));
   reader->closeFilterGroup();
 }
 
@@ -127,20 +614,118 @@ void FindDirectionalModuli::dataCheck()
   clearWarningCode();
   DataArrayPath tempPath;
 
-  // create moduli
+  // check loading directions (one modulus component is created per direction)
   std::vector<size_t> dims(1, 1);
-  tempPath.update(getFeaturePhasesArrayPath().getDataContainerName(), getFeaturePhasesArrayPath().getAttributeMatrixName(), getDirectionalModuliArrayName());
-  m_DirectionalModuliPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, dims, "", DataArrayID31);
+  if(getUseLoadingDirectionsArray())
+  {
+    dims[0] = 3;
+    m_LoadingDirectionsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getLoadingDirectionsArrayPath(), dims);
+    if(nullptr != m_LoadingDirectionsPtr.lock())
+    {
+      m_LoadingDirections = m_LoadingDirectionsPtr.lock()->getPointer(0);
+      dims[0] = m_LoadingDirectionsPtr.lock()->getNumberOfTuples();
+      if(0 == dims[0])
+      {
+        setErrorCondition(-3, "At least one loading direction must be supplied");
+        return;
+      }
+    }
+    else
+    {
+      dims[0] = 1;
+    }
+  }
+  else
+  {
+    m_LoadingDirections = nullptr;
+  }
+
+  // select the orientations to evaluate (average orientation of each feature or the orientation of each element)
+  bool elementLevel = (1 == getOrientationLevel());
+  DataArrayPath phasesPath = elementLevel ? getCellPhasesArrayPath() : getFeaturePhasesArrayPath();
+  DataArrayPath quatsPath = elementLevel ? getCellQuatsArrayPath() : getAvgQuatsArrayPath();
+  std::weak_ptr<DataArray<int32_t>>& phasesPtr = elementLevel ? m_CellPhasesPtr : m_FeaturePhasesPtr;
+  int32_t*& phases = elementLevel ? m_CellPhases : m_FeaturePhases;
+  std::weak_ptr<DataArray<float>>& quatsPtr = elementLevel ? m_CellQuatsPtr : m_AvgQuatsPtr;
+  float*& quats = elementLevel ? m_CellQuats : m_AvgQuats;
+
+  // create moduli
+  tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellDirectionalModuliArrayName() : getDirectionalModuliArrayName());
+  m_DirectionalModuliPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, dims, "", elementLevel ? DataArrayID30 : DataArrayID31);
   if(nullptr != m_DirectionalModuliPtr.lock())
   {
     m_DirectionalModuli = m_DirectionalModuliPtr.lock()->getPointer(0);
   }
 
-  // check feature phases
-  m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeaturePhasesArrayPath(), dims);
-  if(nullptr != m_FeaturePhasesPtr.lock())
+  // create sample frame compliances (21 independent components)
+  if(getComputeSampleCompliances())
+  {
+    std::vector<size_t> complianceComponents(1, DirectionalModulusKernels::k_NumCompliances);
+    tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellSampleCompliancesArrayName() : getSampleCompliancesArrayName());
+    m_SampleCompliancesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, complianceComponents, "", DataArrayID33);
+    if(nullptr != m_SampleCompliancesPtr.lock())
+    {
+      m_SampleCompliances = m_SampleCompliancesPtr.lock()->getPointer(0);
+    }
+  }
+
+  // create extremal moduli (min, max), their sample frame directions (min xyz, max xyz) and anisotropy ratios (max / min)
+  if(getFindExtremalModuli())
   {
-    m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0);
+    std::vector<size_t> extremalComponents(1, 2);
+    tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellExtremalModuliArrayName() : getExtremalModuliArrayName());
+    m_ExtremalModuliPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, extremalComponents, "", DataArrayID34);
+    if(nullptr != m_ExtremalModuliPtr.lock())
+    {
+      m_ExtremalModuli = m_ExtremalModuliPtr.lock()->getPointer(0);
+    }
+
+    extremalComponents[0] = 6;
+    tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellExtremalDirectionsArrayName() : getExtremalDirectionsArrayName());
+    m_ExtremalDirectionsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, extremalComponents, "", DataArrayID35);
+    if(nullptr != m_ExtremalDirectionsPtr.lock())
+    {
+      m_ExtremalDirections = m_ExtremalDirectionsPtr.lock()->getPointer(0);
+    }
+
+    extremalComponents[0] = 1;
+    tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellAnisotropyRatiosArrayName() : getAnisotropyRatiosArrayName());
+    m_AnisotropyRatiosPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, extremalComponents, "", DataArrayID36);
+    if(nullptr != m_AnisotropyRatiosPtr.lock())
+    {
+      m_AnisotropyRatios = m_AnisotropyRatiosPtr.lock()->getPointer(0);
+    }
+  }
+
+  // create shear moduli and Poisson's ratios (one component per loading direction, like the moduli)
+  if(getComputeShearAndPoisson())
+  {
+    tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellShearModuliArrayName() : getShearModuliArrayName());
+    m_ShearModuliPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, dims, "", DataArrayID37);
+    if(nullptr != m_ShearModuliPtr.lock())
+    {
+      m_ShearModuli = m_ShearModuliPtr.lock()->getPointer(0);
+    }
+
+    tempPath.update(phasesPath.getDataContainerName(), phasesPath.getAttributeMatrixName(), elementLevel ? getCellPoissonRatiosArrayName() : getPoissonRatiosArrayName());
+    m_PoissonRatiosPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, dims, "", DataArrayID38);
+    if(nullptr != m_PoissonRatiosPtr.lock())
+    {
+      m_PoissonRatios = m_PoissonRatiosPtr.lock()->getPointer(0);
+    }
+
+    if(0 == m_TransverseDirection[0] && 0 == m_TransverseDirection[1] && 0 == m_TransverseDirection[2])
+    {
+      setErrorCondition(-5, "A non-zero transverse direction must be choosen");
+    }
+  }
+
+  // check phases
+  dims[0] = 1;
+  phasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, phasesPath, dims);
+  if(nullptr != phasesPtr.lock())
+  {
+    phases = phasesPtr.lock()->getPointer(0);
   }
 
   // check crystal structures
@@ -153,10 +738,10 @@ void FindDirectionalModuli::dataCheck()
 
   // check quats
   dims[0] = 4;
-  m_AvgQuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getAvgQuatsArrayPath(), dims);
-  if(nullptr != m_AvgQuatsPtr.lock())
+  quatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, quatsPath, dims);
+  if(nullptr != quatsPtr.lock())
   {
-    m_AvgQuats = m_AvgQuatsPtr.lock()->getPointer(0);
+    quats = quatsPtr.lock()->getPointer(0);
   }
 
   // check compliances
@@ -168,15 +753,15 @@ void FindDirectionalModuli::dataCheck()
   }
 
   // make sure the direction isn't undefined
-  if(0 == m_LoadingDirection[0] && 0 == m_LoadingDirection[1] && 0 == m_LoadingDirection[2])
+  if(!getUseLoadingDirectionsArray() && 0 == m_LoadingDirection[0] && 0 == m_LoadingDirection[1] && 0 == m_LoadingDirection[2])
   {
     setErrorCondition(-1, "A non-zero direction must be choosen");
   }
 
   // make sure quats + phases are from same attribute matrix + data container
-  if(!getFeaturePhasesArrayPath().hasSameAttributeMatrixPath(getAvgQuatsArrayPath()))
+  if(!phasesPath.hasSameAttributeMatrixPath(quatsPath))
   {
-    setErrorCondition(-2, "Feature Phases and Average Quats must belong to the same DataContainer / AtributreMatrix");
+    setErrorCondition(-2, elementLevel ? "Phases and Quats must belong to the same DataContainer / AtributreMatrix" : "Feature Phases and Average Quats must belong to the same DataContainer / AtributreMatrix");
   }
 
   // make sure compliances + crystal structures are from the same attribute matrix + data container
@@ -186,9 +771,9 @@ void FindDirectionalModuli::dataCheck()
   }
 
   // make sure everything is in the same data container (may not be true for synthetic volumes using a stats gen container but the user can copy the ensemble attribute matrix over)
-  if(!getAvgQuatsArrayPath().hasSameDataContainer(getCrystalStructuresArrayPath()))
+  if(!quatsPath.hasSameDataContainer(getCrystalStructuresArrayPath()))
   {
-    setErrorCondition(-2, "Crystal Structures and Average Quaternions must belong to the same DataContainer");
+    setErrorCondition(-2, elementLevel ? "Crystal Structures and Quaternions must belong to the same DataContainer" : "Crystal Structures and Average Quaternions must belong to the same DataContainer");
   }
 }
 
@@ -203,194 +788,253 @@ void FindDirectionalModuli::execute()
     return;
   }
 
-  // get number of features
-  size_t totalFeatures = m_DirectionalModuliPtr.lock()->getNumberOfTuples();
+  // get the selected orientations, number of features (or elements) and loading directions
+  bool elementLevel = (1 == getOrientationLevel());
+  int32_t* phases = elementLevel ? m_CellPhases : m_FeaturePhases;
+  float* quats = elementLevel ? m_CellQuats : m_AvgQuats;
+  DataArray<float>::Pointer moduliPtr = m_DirectionalModuliPtr.lock();
+  float* moduli = moduliPtr->getPointer(0);
+  size_t totalTuples = moduliPtr->getNumberOfTuples();
+  size_t numDirections = moduliPtr->getNumberOfComponents();
+  float* sampleCompliances = nullptr;
+  if(m_ComputeSampleCompliances)
+  {
+    sampleCompliances = m_SampleCompliances;
+  }
+  float* extremalModuli = nullptr;
+  float* extremalDirections = nullptr;
+  float* anisotropyRatios = nullptr;
+  if(m_FindExtremalModuli)
+  {
+    extremalModuli = m_ExtremalModuli;
+    extremalDirections = m_ExtremalDirections;
+    anisotropyRatios = m_AnisotropyRatios;
+  }
+  float* shearModuli = nullptr;
+  float* poissonRatios = nullptr;
+  if(m_ComputeShearAndPoisson)
+  {
+    shearModuli = m_ShearModuli;
+    poissonRatios = m_PoissonRatios;
+  }
 
-  QuatF q1, q2;
-  float sampleLoading[3];
-  // float crystalLoading[3];
+  // determine a rotation that aligns each loading direction with the sample 100 direction (as quaternion)
+  std::vector<DirectionalModulusKernels::QuaternionProductMatrix> loadingRotations(numDirections);
+  std::vector<DirectionalModulusKernels::QuaternionProductMatrix> transverseRotations(m_ComputeShearAndPoisson ? numDirections : 0);
+  for(size_t d = 0; d < numDirections; d++)
+  {
+    float sampleLoading[3] = {m_LoadingDirection[0], m_LoadingDirection[1], m_LoadingDirection[2]};
+    if(m_UseLoadingDirectionsArray)
+    {
+      std::copy(m_LoadingDirections + 3 * d, m_LoadingDirections + 3 * d + 3, sampleLoading);
+      if(0 == sampleLoading[0] && 0 == sampleLoading[1] && 0 == sampleLoading[2])
+      {
+        QString ss = QObject::tr("Loading direction %1 is undefined (a non-zero direction must be choosen)").arg(d);
+        setErrorCondition(-3, ss);
+        return;
+      }
+    }
+    loadingRotations[d] = LoadingRotationMatrix(FindLoadingRotation(sampleLoading));
 
-  // normalize loading direction
-  sampleLoading[0] = m_LoadingDirection[0];
-  sampleLoading[1] = m_LoadingDirection[1];
-  sampleLoading[2] = m_LoadingDirection[2];
-  MatrixMath::Normalize3x1(sampleLoading);
+    // the transverse direction is made perpendicular to the (now normalized) loading direction and rotated the same way
+    if(m_ComputeShearAndPoisson)
+    {
+      float sampleTransverse[3] = {m_TransverseDirection[0], m_TransverseDirection[1], m_TransverseDirection[2]};
+      MatrixMath::Normalize3x1(sampleTransverse);
+      float projection = MatrixMath::DotProduct3x1(sampleTransverse, sampleLoading);
+      for(size_t k = 0; k < 3; k++)
+      {
+        sampleTransverse[k] -= projection * sampleLoading[k];
+      }
+      if(MatrixMath::Magnitude3x1(sampleTransverse) < 1.0e-3f)
+      {
+        QString ss = QObject::tr("The transverse direction is parallel to loading direction %1").arg(d);
+        setErrorCondition(-5, ss);
+        return;
+      }
+      transverseRotations[d] = LoadingRotationMatrix(FindLoadingRotation(sampleTransverse));
+    }
+  }
 
-  // determine a rotation that aligns the loading with the sample 100 direction (as quaternion)
-  if(sampleLoading[0] >= 1.0f - std::numeric_limits<float>::epsilon())
+  // fold the compliances of each phase into s'11 coefficients and select its kernel once
+  size_t numPhases = m_CrystalStructuresPtr.lock()->getNumberOfTuples();
+  std::vector<DirectionalModulusKernels::ComplianceCoefficients> coefficients(numPhases);
+  std::vector<DirectionalModulusKernels::ElasticSymmetry> symmetries(numPhases);
+  for(size_t p = 0; p < numPhases; p++)
   {
-    // already 100 aligned
-    q2 = QuatF::identity();
+    coefficients[p] = DirectionalModulusKernels::ComplianceCoefficients::FromCompliances(m_CrystalCompliances + 36 * p);
+    symmetries[p] = DirectionalModulusKernels::FindElasticSymmetry(m_CrystalStructures[p]);
   }
-  else if(sampleLoading[0] <= -1.0f + std::numeric_limits<float>::epsilon())
+
+  // find the extremal moduli of each phase once
+  std::vector<DirectionalModulusKernels::ExtremalModuli> extremal(numPhases);
+  if(m_FindExtremalModuli)
   {
-    //-100 aligned (rotate 180 deg about any non 100 axis)
-    q2[0] = 0.0f;
-    q2[1] = 0.0f;
-    q2[2] = 1.0f;
-    q2[3] = 0.0f;
+    for(size_t p = 0; p < numPhases; p++)
+    {
+      if(m_CrystalStructures[p] < EbsdLib::CrystalStructure::LaueGroupEnd)
+      {
+        extremal[p] = DirectionalModulusKernels::FindExtremalModuli(symmetries[p], coefficients[p]);
+      }
+    }
+  }
+
+  // outputs of each feature (or element) and their number of components, in the order they are kept for incremental updates
+  std::vector<std::pair<float*, size_t>> outputs = {{moduli, numDirections},
+                                                    {sampleCompliances, DirectionalModulusKernels::k_NumCompliances},
+                                                    {extremalModuli, 2},
+                                                    {extremalDirections, 6},
+                                                    {anisotropyRatios, 1},
+                                                    {shearModuli, numDirections},
+                                                    {poissonRatios, numDirections}};
+
+  // evaluate in chunks (streaming straight from the input arrays into the outputs) so that very large element level
+  // inputs report progress and can be canceled
+  auto evaluate = [&](int32_t* tuplePhases, float* tupleQuats, const std::vector<float*>& tupleOutputs, size_t numTuples) {
+    FindDirectionalModuliImpl impl(tuplePhases, tupleQuats, m_CrystalStructures, coefficients, symmetries, loadingRotations, tupleOutputs[0], m_CrystalCompliances, tupleOutputs[1],
+                                   extremal, tupleOutputs[2], tupleOutputs[3], tupleOutputs[4], transverseRotations, tupleOutputs[5], tupleOutputs[6]);
+    for(size_t chunkStart = 0; chunkStart < numTuples; chunkStart += k_ChunkSize)
+    {
+      if(getCancel())
+      {
+        return false;
+      }
+
+      size_t chunkEnd = std::min(chunkStart + k_ChunkSize, numTuples);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(chunkStart, chunkEnd, k_GrainSize), impl, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        impl.generate(chunkStart, chunkEnd);
+      }
+
+      if(chunkEnd < numTuples)
+      {
+        QString ss = QObject::tr("Computed %1 of %2 Directional Moduli").arg(chunkEnd).arg(numTuples);
+        notifyStatusMessage(ss);
+      }
+    }
+    return true;
+  };
+
+  if(!m_IncrementalUpdate)
+  {
+    m_PreviousFingerprints.clear();
+    m_PreviousOutputs.clear();
+    std::vector<float*> tupleOutputs(outputs.size());
+    std::transform(outputs.begin(), outputs.end(), tupleOutputs.begin(), [](const std::pair<float*, size_t>& output) { return output.first; });
+    evaluate(phases, quats, tupleOutputs, totalTuples);
+    m_NumberOfRecomputedTuples = totalTuples;
+    notifyStatusMessage("Completed");
+    return;
+  }
+
+  // fingerprint everything that changes the outputs: the settings, each phase (crystal structure + compliances) and each orientation
+  uint64_t settingsFingerprint = MixFingerprint(0, static_cast<uint64_t>(m_OrientationLevel));
+  for(const std::pair<float*, size_t>& output : outputs)
+  {
+    settingsFingerprint = MixFingerprint(settingsFingerprint, nullptr == output.first ? 0 : output.second);
+  }
+  for(const std::vector<DirectionalModulusKernels::QuaternionProductMatrix>* rotations : {&loadingRotations, &transverseRotations})
+  {
+    for(const DirectionalModulusKernels::QuaternionProductMatrix& rotation : *rotations)
+    {
+      settingsFingerprint = FloatFingerprint(settingsFingerprint, rotation.data(), rotation.size());
+    }
+  }
+  std::vector<uint64_t> phaseFingerprints(numPhases);
+  for(size_t p = 0; p < numPhases; p++)
+  {
+    phaseFingerprints[p] = FloatFingerprint(MixFingerprint(p, m_CrystalStructures[p]), m_CrystalCompliances + 36 * p, 36);
+  }
+
+  std::vector<uint64_t> fingerprints(totalTuples);
+  FindDirectionalModuliFingerprintImpl fingerprintImpl(phases, quats, phaseFingerprints, fingerprints.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalTuples, k_GrainSize), fingerprintImpl, tbb::auto_partitioner());
   }
   else
+#endif
   {
-    // not a special case, get appropriate quaternion manually
-    /* for two unit vectors u and v the quaternion defining the rotation (u -> v)
-     *  n = u x v
-     *  q[0] = n[0]
-     *  q[1] = n[1]
-     *  q[2] = n[2]
-     *  q.w = 1 + u.v
-     *  normalize q
-     */
-    q2[0] = 0.0f;
-    q2[1] = sampleLoading[2];
-    q2[2] = -sampleLoading[1];
-    q2[3] = 1.0f + sampleLoading[0];
-    q2 = q2.unitQuaternion();
+    fingerprintImpl.generate(0, totalTuples);
   }
 
-  // loop over all grains
-  for(size_t i = 0; i < totalFeatures; i++)
+  // the previous outputs can only be reused if the settings and number of features (or elements) are unchanged
+  bool reuse = (settingsFingerprint == m_PreviousSettingsFingerprint && fingerprints.size() == m_PreviousFingerprints.size() && outputs.size() == m_PreviousOutputs.size());
+  std::vector<size_t> changed;
+  if(reuse)
+  {
+    for(size_t i = 0; i < totalTuples; i++)
+    {
+      if(fingerprints[i] != m_PreviousFingerprints[i])
+      {
+        changed.push_back(i);
+      }
+    }
+  }
+  else
   {
-    // default to 0
-    m_DirectionalModuli[i] = 0;
+    m_PreviousOutputs.resize(outputs.size());
+    for(size_t k = 0; k < outputs.size(); k++)
+    {
+      m_PreviousOutputs[k].assign(nullptr == outputs[k].first ? 0 : totalTuples * outputs[k].second, 0.0f);
+    }
+    changed.resize(totalTuples);
+    std::iota(changed.begin(), changed.end(), 0);
+  }
 
-    // get phase and crystal structure
-    size_t phase = m_FeaturePhases[i];
-    size_t xtal = m_CrystalStructures[phase];
-    if(xtal < EbsdLib::CrystalStructure::LaueGroupEnd)
+  // evaluate the changed features (or elements) only, gathered into compact arrays
+  std::vector<int32_t> changedPhases(changed.size());
+  std::vector<float> changedQuats(4 * changed.size());
+  for(size_t j = 0; j < changed.size(); j++)
+  {
+    changedPhases[j] = phases[changed[j]];
+    std::copy(quats + 4 * changed[j], quats + 4 * changed[j] + 4, changedQuats.begin() + 4 * j);
+  }
+  std::vector<std::vector<float>> changedOutputs(outputs.size());
+  std::vector<float*> changedOutputPtrs(outputs.size(), nullptr);
+  for(size_t k = 0; k < outputs.size(); k++)
+  {
+    if(nullptr != outputs[k].first)
     {
-      float* avgQuatPtr = m_AvgQuats + i * 4;
-      // concatenate rotation with crystal orientation (determine rotation from crystal frame to sample loading direction)
-      q1 = QuatF(avgQuatPtr[0], avgQuatPtr[1], avgQuatPtr[2], avgQuatPtr[3]);
-      QuatF qTotal = q1 * q2;
-
-      /*
-      This method is straightforward but computationally very expensive/wasteful (since it computes the full rotated compliance matrix and we only need s'11)
-
-      //convert orientation to rotation matrix and invert (need rotation from crystal -> sample frame)
-      QuaternionMathF::Conjugate(qTotal);
-      OrientationMath::QuattoMat(q1, g);
-
-      //construct 6x6 compliance rotation matrix (after Applied Mechanics of Solids, A.F. Bower: pg. 80)
-        //compute quadrants of stiffness rotation matrix
-        float k1[3][3];
-        float k2[3][3];
-        float k3[3][3];
-        float k4[3][3];
-        for(int j = 0; j < 3; j++)
-        {
-          int j1mod3 = (j + 1) % 3;
-          int j2mod3 = (j + 2) % 3;
-          for(int k = 0; k < 3; k++)
-          {
-            int k1mod3 = (k + 1) % 3;
-            int k2mod3 = (k + 2) % 3;
-            k1[j][k] = g[j][k] * g[j][k];
-            k2[j][k] = 2.0f * g[j][k1mod3] * g[j][k2mod3];
-            k3[j][k] = g[j1mod3][k] * g[j2mod3][k];
-            k4[j][k] = g[j1mod3][k1mod3] * g[j2mod3][k2mod3] + g[j1mod3][k2mod3] * g[j2mod3][k1mod3];
-          }
-        }
+      changedOutputs[k].resize(changed.size() * outputs[k].second);
+      changedOutputPtrs[k] = changedOutputs[k].data();
+    }
+  }
+  if(!evaluate(changedPhases.data(), changedQuats.data(), changedOutputPtrs, changed.size()))
+  {
+    // a partial update would leave the kept outputs out of sync with the fingerprints
+    m_PreviousFingerprints.clear();
+    m_PreviousOutputs.clear();
+    return;
+  }
 
-        //assemble stiffness rotation matrix
-        Matrix6f k;
-        k << k1[0][0], k1[0][1], k1[0][2], k2[0][0], k2[0][1], k2[0][2],
-             k1[1][0], k1[1][1], k1[1][2], k2[1][0], k2[1][1], k2[1][2],
-             k1[2][0], k1[2][1], k1[2][2], k2[2][0], k2[2][1], k2[2][2],
-             k3[0][0], k3[0][1], k3[0][2], k4[0][0], k4[0][1], k4[0][2],
-             k3[1][0], k3[1][1], k3[1][2], k4[1][0], k4[1][1], k4[1][2],
-             k3[2][0], k3[2][1], k3[2][2], k4[2][0], k4[2][1], k4[2][2];
-
-        //compute compliance rotation matrix
-        k = k.inverse();
-
-      //rotate compliance to sample frame
-      Matrix6f sampleCompliance = (k.transpose() * compliance[phase]) * k;
-
-      //compute modulus
-      m_DirectionalModuli[i] = 1.0f / sampleCompliance(0, 0);
-
-      */
-
-      // Instead I've solved the above symbolically for the quaternion derivted rotation matrix
-      // float g00 = (1.0f - (2.0f * q1[1] * q1[1]) - (2.0f * q1[2] * q1[2]));
-      // float g01 = ((2.0f * q1[0] * q1[1]) - (2.0f * q1[2] * q1.w));
-      // float g02 = ((2.0f * q1[0] * q1[2]) + (2.0f * q1[1] * q1.w));
-
-      // float g10 = ((2.0f * q1[0] * q1[1]) + (2.0f * q1[2] * q1.w));
-      // float g11 = (1.0f - (2.0f * q1[0] * q1[0]) - (2.0f * q1[2] * q1[2]));
-      // float g12 = (2.0f * q1[1] * q1[2]) - (2.0f * q1[0] * q1.w);
-
-      // float g20 = ((2.0f * q1[0] * q1[2]) - (2.0f * q1[1] * q1.w));
-      // float g21 = (2.0f * q1[1] * q1[2]) + (2.0f * q1[0] * q1.w);
-      // float g22 = (1.0f - (2.0f * q1[0] * q1[0]) - (2.0f * q1[1] * q1[1]));
-
-      // everything simplifies to a function of 4 factors
-      // float a = g11 * g22 - g12 * g21;
-      // float b = g12 * g20 - g10 * g22;
-      // float c = g10 * g21 - g11 * g20;
-      // float denom = powf(g02 * g11 * g20 - g01 * g12 * g20 - g02 * g10 * g21 + g00 * g12 * g21 + g01 * g10 * g22 - g00 * g11 * g22, 4);
-
-      // these can be expressed more compactly directly from quaternions (especially if a unit quaternion is assumed)
-      float a = 1.0f - 2.0f * (qTotal[1] * qTotal[1] + qTotal[2] * qTotal[2]);
-      float b = 2.0f * (qTotal[0] * qTotal[1] - qTotal[2] * qTotal[3]);
-      float c = 2.0f * (qTotal[0] * qTotal[2] + qTotal[1] * qTotal[3]);
-      // denom = 1.0
-
-      // squares are used extensively, compute once
-      float a2 = a * a;
-      float b2 = b * b;
-      float c2 = c * c;
-
-      // compute rotated compliance weightings
-      float s11Coef = a2 * a2; // a^4
-      float s22Coef = b2 * b2; // b^4
-      float s33Coef = c2 * c2; // c^4
-      float s44Coef = b2 * c2; // b^2 c^2
-      float s55Coef = a2 * c2; // a^2 c^2
-      float s66Coef = a2 * b2; // a^2 b^2
-
-      float s12Coef = 2.0f * a2 * b2; // 2 a^2 b^2
-      float s23Coef = 2.0f * b2 * c2; // 2 b^2 c^2
-      float s13Coef = 2.0f * a2 * c2; // 2 a^2 c^2
-
-      float s14Coef = 2.0f * a2 * b * c; // 2 a^2 b c
-      float s15Coef = 2.0f * a2 * a * c; // 2 a^3 c
-      float s16Coef = 2.0f * a2 * a * b; // 2 a^3 b
-
-      float s24Coef = 2.0f * b2 * b * c; // 2 b^3 c
-      float s25Coef = 2.0f * b2 * a * c; // 2 a b^2 c
-      float s26Coef = 2.0f * b2 * a * b; // 2 a b^3
-      float s34Coef = 2.0f * c2 * b * c; // 2 b c^3
-      float s35Coef = 2.0f * c2 * a * c; // 2 a c^3
-      float s36Coef = 2.0f * c2 * a * b; // 2 a b c^2
-
-      float s45Coef = 2.0f * a * b * c2; // 2 a b c^2
-      float s46Coef = 2.0f * a * b2 * c; // 2 a b^2 c
-      float s56Coef = 2.0f * a2 * b * c; // 2 a^2 b c
-
-      // compute rotated compliance
-      size_t index = 36 * phase;
-      float s11prime = s11Coef * m_CrystalCompliances[index + 0] + s12Coef * m_CrystalCompliances[index + 1] + s13Coef * m_CrystalCompliances[index + 2] + s14Coef * m_CrystalCompliances[index + 3] +
-                       s15Coef * m_CrystalCompliances[index + 4] + s16Coef * m_CrystalCompliances[index + 5] +
-
-                       s22Coef * m_CrystalCompliances[index + 7] + s23Coef * m_CrystalCompliances[index + 8] + s24Coef * m_CrystalCompliances[index + 9] + s25Coef * m_CrystalCompliances[index + 10] +
-                       s26Coef * m_CrystalCompliances[index + 11] +
-
-                       s33Coef * m_CrystalCompliances[index + 14] + s34Coef * m_CrystalCompliances[index + 15] + s35Coef * m_CrystalCompliances[index + 16] +
-                       s36Coef * m_CrystalCompliances[index + 17] +
-
-                       s44Coef * m_CrystalCompliances[index + 21] + s45Coef * m_CrystalCompliances[index + 22] + s46Coef * m_CrystalCompliances[index + 23] +
-
-                       s55Coef * m_CrystalCompliances[index + 28] + s56Coef * m_CrystalCompliances[index + 29] +
-
-                       s66Coef * m_CrystalCompliances[index + 35];
-
-      // compute modulus
-      m_DirectionalModuli[i] = 1.0f / s11prime;
+  // merge the new values into the kept outputs and copy them into the created arrays
+  for(size_t k = 0; k < outputs.size(); k++)
+  {
+    if(nullptr == outputs[k].first)
+    {
+      continue;
     }
+    size_t numComponents = outputs[k].second;
+    for(size_t j = 0; j < changed.size(); j++)
+    {
+      std::copy(changedOutputs[k].begin() + j * numComponents, changedOutputs[k].begin() + (j + 1) * numComponents, m_PreviousOutputs[k].begin() + changed[j] * numComponents);
+    }
+    std::copy(m_PreviousOutputs[k].begin(), m_PreviousOutputs[k].end(), outputs[k].first);
   }
+  m_PreviousSettingsFingerprint = settingsFingerprint;
+  m_PreviousFingerprints.swap(fingerprints);
+  m_NumberOfRecomputedTuples = changed.size();
 
+  QString ss = QObject::tr("Recomputed %1 of %2 Directional Moduli").arg(changed.size()).arg(totalTuples);
+  notifyStatusMessage(ss);
   notifyStatusMessage("Completed");
 }
 
@@ -565,3 +1209,285 @@ FloatVec3Type FindDirectionalModuli::getLoadingDirection() const
 {
   return m_LoadingDirection;
 }
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setUseLoadingDirectionsArray(bool value)
+{
+  m_UseLoadingDirectionsArray = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindDirectionalModuli::getUseLoadingDirectionsArray() const
+{
+  return m_UseLoadingDirectionsArray;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setLoadingDirectionsArrayPath(const DataArrayPath& value)
+{
+  m_LoadingDirectionsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindDirectionalModuli::getLoadingDirectionsArrayPath() const
+{
+  return m_LoadingDirectionsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setOrientationLevel(int value)
+{
+  m_OrientationLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindDirectionalModuli::getOrientationLevel() const
+{
+  return m_OrientationLevel;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellPhasesArrayPath(const DataArrayPath& value)
+{
+  m_CellPhasesArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindDirectionalModuli::getCellPhasesArrayPath() const
+{
+  return m_CellPhasesArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellQuatsArrayPath(const DataArrayPath& value)
+{
+  m_CellQuatsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindDirectionalModuli::getCellQuatsArrayPath() const
+{
+  return m_CellQuatsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellDirectionalModuliArrayName(const QString& value)
+{
+  m_CellDirectionalModuliArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellDirectionalModuliArrayName() const
+{
+  return m_CellDirectionalModuliArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setComputeSampleCompliances(bool value)
+{
+  m_ComputeSampleCompliances = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindDirectionalModuli::getComputeSampleCompliances() const
+{
+  return m_ComputeSampleCompliances;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setSampleCompliancesArrayName(const QString& value)
+{
+  m_SampleCompliancesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getSampleCompliancesArrayName() const
+{
+  return m_SampleCompliancesArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellSampleCompliancesArrayName(const QString& value)
+{
+  m_CellSampleCompliancesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellSampleCompliancesArrayName() const
+{
+  return m_CellSampleCompliancesArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setFindExtremalModuli(bool value)
+{
+  m_FindExtremalModuli = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindDirectionalModuli::getFindExtremalModuli() const
+{
+  return m_FindExtremalModuli;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setExtremalModuliArrayName(const QString& value)
+{
+  m_ExtremalModuliArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getExtremalModuliArrayName() const
+{
+  return m_ExtremalModuliArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellExtremalModuliArrayName(const QString& value)
+{
+  m_CellExtremalModuliArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellExtremalModuliArrayName() const
+{
+  return m_CellExtremalModuliArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setExtremalDirectionsArrayName(const QString& value)
+{
+  m_ExtremalDirectionsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getExtremalDirectionsArrayName() const
+{
+  return m_ExtremalDirectionsArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellExtremalDirectionsArrayName(const QString& value)
+{
+  m_CellExtremalDirectionsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellExtremalDirectionsArrayName() const
+{
+  return m_CellExtremalDirectionsArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setAnisotropyRatiosArrayName(const QString& value)
+{
+  m_AnisotropyRatiosArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getAnisotropyRatiosArrayName() const
+{
+  return m_AnisotropyRatiosArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellAnisotropyRatiosArrayName(const QString& value)
+{
+  m_CellAnisotropyRatiosArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellAnisotropyRatiosArrayName() const
+{
+  return m_CellAnisotropyRatiosArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setComputeShearAndPoisson(bool value)
+{
+  m_ComputeShearAndPoisson = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindDirectionalModuli::getComputeShearAndPoisson() const
+{
+  return m_ComputeShearAndPoisson;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setTransverseDirection(const FloatVec3Type& value)
+{
+  m_TransverseDirection = value;
+}
+
+// -----------------------------------------------------------------------------
+FloatVec3Type FindDirectionalModuli::getTransverseDirection() const
+{
+  return m_TransverseDirection;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setShearModuliArrayName(const QString& value)
+{
+  m_ShearModuliArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getShearModuliArrayName() const
+{
+  return m_ShearModuliArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellShearModuliArrayName(const QString& value)
+{
+  m_CellShearModuliArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellShearModuliArrayName() const
+{
+  return m_CellShearModuliArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setPoissonRatiosArrayName(const QString& value)
+{
+  m_PoissonRatiosArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getPoissonRatiosArrayName() const
+{
+  return m_PoissonRatiosArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setCellPoissonRatiosArrayName(const QString& value)
+{
+  m_CellPoissonRatiosArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindDirectionalModuli::getCellPoissonRatiosArrayName() const
+{
+  return m_CellPoissonRatiosArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindDirectionalModuli::setIncrementalUpdate(bool value)
+{
+  m_IncrementalUpdate = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindDirectionalModuli::getIncrementalUpdate() const
+{
+  return m_IncrementalUpdate;
+}
+
+// -----------------------------------------------------------------------------
+size_t FindDirectionalModuli::getNumberOfRecomputedTuples() const
+{
+  return m_NumberOfRecomputedTuples;
+}
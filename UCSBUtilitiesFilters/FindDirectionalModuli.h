@@ -53,6 +53,29 @@ class UCSBUtilities_EXPORT FindDirectionalModuli : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
   PYB11_PROPERTY(QString DirectionalModuliArrayName READ getDirectionalModuliArrayName WRITE setDirectionalModuliArrayName)
   PYB11_PROPERTY(FloatVec3Type LoadingDirection READ getLoadingDirection WRITE setLoadingDirection)
+  PYB11_PROPERTY(bool UseLoadingDirectionsArray READ getUseLoadingDirectionsArray WRITE setUseLoadingDirectionsArray)
+  PYB11_PROPERTY(DataArrayPath LoadingDirectionsArrayPath READ getLoadingDirectionsArrayPath WRITE setLoadingDirectionsArrayPath)
+  PYB11_PROPERTY(int OrientationLevel READ getOrientationLevel WRITE setOrientationLevel)
+  PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
+  PYB11_PROPERTY(DataArrayPath CellQuatsArrayPath READ getCellQuatsArrayPath WRITE setCellQuatsArrayPath)
+  PYB11_PROPERTY(QString CellDirectionalModuliArrayName READ getCellDirectionalModuliArrayName WRITE setCellDirectionalModuliArrayName)
+  PYB11_PROPERTY(bool ComputeSampleCompliances READ getComputeSampleCompliances WRITE setComputeSampleCompliances)
+  PYB11_PROPERTY(QString SampleCompliancesArrayName READ getSampleCompliancesArrayName WRITE setSampleCompliancesArrayName)
+  PYB11_PROPERTY(QString CellSampleCompliancesArrayName READ getCellSampleCompliancesArrayName WRITE setCellSampleCompliancesArrayName)
+  PYB11_PROPERTY(bool FindExtremalModuli READ getFindExtremalModuli WRITE setFindExtremalModuli)
+  PYB11_PROPERTY(QString ExtremalModuliArrayName READ getExtremalModuliArrayName WRITE setExtremalModuliArrayName)
+  PYB11_PROPERTY(QString CellExtremalModuliArrayName READ getCellExtremalModuliArrayName WRITE setCellExtremalModuliArrayName)
+  PYB11_PROPERTY(QString ExtremalDirectionsArrayName READ getExtremalDirectionsArrayName WRITE setExtremalDirectionsArrayName)
+  PYB11_PROPERTY(QString CellExtremalDirectionsArrayName READ getCellExtremalDirectionsArrayName WRITE setCellExtremalDirectionsArrayName)
+  PYB11_PROPERTY(QString AnisotropyRatiosArrayName READ getAnisotropyRatiosArrayName WRITE setAnisotropyRatiosArrayName)
+  PYB11_PROPERTY(QString CellAnisotropyRatiosArrayName READ getCellAnisotropyRatiosArrayName WRITE setCellAnisotropyRatiosArrayName)
+  PYB11_PROPERTY(bool ComputeShearAndPoisson READ getComputeShearAndPoisson WRITE setComputeShearAndPoisson)
+  PYB11_PROPERTY(FloatVec3Type TransverseDirection READ getTransverseDirection WRITE setTransverseDirection)
+  PYB11_PROPERTY(QString ShearModuliArrayName READ getShearModuliArrayName WRITE setShearModuliArrayName)
+  PYB11_PROPERTY(QString CellShearModuliArrayName READ getCellShearModuliArrayName WRITE setCellShearModuliArrayName)
+  PYB11_PROPERTY(QString PoissonRatiosArrayName READ getPoissonRatiosArrayName WRITE setPoissonRatiosArrayName)
+  PYB11_PROPERTY(QString CellPoissonRatiosArrayName READ getCellPoissonRatiosArrayName WRITE setCellPoissonRatiosArrayName)
+  PYB11_PROPERTY(bool IncrementalUpdate READ getIncrementalUpdate WRITE setIncrementalUpdate)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -149,6 +172,289 @@ public:
 
   Q_PROPERTY(FloatVec3Type LoadingDirection READ getLoadingDirection WRITE setLoadingDirection)
 
+  /**
+   * @brief Setter property for UseLoadingDirectionsArray
+   */
+  void setUseLoadingDirectionsArray(bool value);
+  /**
+   * @brief Getter property for UseLoadingDirectionsArray
+   * @return Value of UseLoadingDirectionsArray
+   */
+  bool getUseLoadingDirectionsArray() const;
+
+  Q_PROPERTY(bool UseLoadingDirectionsArray READ getUseLoadingDirectionsArray WRITE setUseLoadingDirectionsArray)
+
+  /**
+   * @brief Setter property for LoadingDirectionsArrayPath
+   */
+  void setLoadingDirectionsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for LoadingDirectionsArrayPath
+   * @return Value of LoadingDirectionsArrayPath
+   */
+  DataArrayPath getLoadingDirectionsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath LoadingDirectionsArrayPath READ getLoadingDirectionsArrayPath WRITE setLoadingDirectionsArrayPath)
+
+  /**
+   * @brief Setter property for OrientationLevel
+   */
+  void setOrientationLevel(int value);
+  /**
+   * @brief Getter property for OrientationLevel
+   * @return Value of OrientationLevel
+   */
+  int getOrientationLevel() const;
+
+  Q_PROPERTY(int OrientationLevel READ getOrientationLevel WRITE setOrientationLevel)
+
+  /**
+   * @brief Setter property for CellPhasesArrayPath
+   */
+  void setCellPhasesArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for CellPhasesArrayPath
+   * @return Value of CellPhasesArrayPath
+   */
+  DataArrayPath getCellPhasesArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
+
+  /**
+   * @brief Setter property for CellQuatsArrayPath
+   */
+  void setCellQuatsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for CellQuatsArrayPath
+   * @return Value of CellQuatsArrayPath
+   */
+  DataArrayPath getCellQuatsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath CellQuatsArrayPath READ getCellQuatsArrayPath WRITE setCellQuatsArrayPath)
+
+  /**
+   * @brief Setter property for CellDirectionalModuliArrayName
+   */
+  void setCellDirectionalModuliArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellDirectionalModuliArrayName
+   * @return Value of CellDirectionalModuliArrayName
+   */
+  QString getCellDirectionalModuliArrayName() const;
+
+  Q_PROPERTY(QString CellDirectionalModuliArrayName READ getCellDirectionalModuliArrayName WRITE setCellDirectionalModuliArrayName)
+
+  /**
+   * @brief Setter property for ComputeSampleCompliances
+   */
+  void setComputeSampleCompliances(bool value);
+  /**
+   * @brief Getter property for ComputeSampleCompliances
+   * @return Value of ComputeSampleCompliances
+   */
+  bool getComputeSampleCompliances() const;
+
+  Q_PROPERTY(bool ComputeSampleCompliances READ getComputeSampleCompliances WRITE setComputeSampleCompliances)
+
+  /**
+   * @brief Setter property for SampleCompliancesArrayName
+   */
+  void setSampleCompliancesArrayName(const QString& value);
+  /**
+   * @brief Getter property for SampleCompliancesArrayName
+   * @return Value of SampleCompliancesArrayName
+   */
+  QString getSampleCompliancesArrayName() const;
+
+  Q_PROPERTY(QString SampleCompliancesArrayName READ getSampleCompliancesArrayName WRITE setSampleCompliancesArrayName)
+
+  /**
+   * @brief Setter property for CellSampleCompliancesArrayName
+   */
+  void setCellSampleCompliancesArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellSampleCompliancesArrayName
+   * @return Value of CellSampleCompliancesArrayName
+   */
+  QString getCellSampleCompliancesArrayName() const;
+
+  Q_PROPERTY(QString CellSampleCompliancesArrayName READ getCellSampleCompliancesArrayName WRITE setCellSampleCompliancesArrayName)
+
+  /**
+   * @brief Setter property for FindExtremalModuli
+   */
+  void setFindExtremalModuli(bool value);
+  /**
+   * @brief Getter property for FindExtremalModuli
+   * @return Value of FindExtremalModuli
+   */
+  bool getFindExtremalModuli() const;
+
+  Q_PROPERTY(bool FindExtremalModuli READ getFindExtremalModuli WRITE setFindExtremalModuli)
+
+  /**
+   * @brief Setter property for ExtremalModuliArrayName
+   */
+  void setExtremalModuliArrayName(const QString& value);
+  /**
+   * @brief Getter property for ExtremalModuliArrayName
+   * @return Value of ExtremalModuliArrayName
+   */
+  QString getExtremalModuliArrayName() const;
+
+  Q_PROPERTY(QString ExtremalModuliArrayName READ getExtremalModuliArrayName WRITE setExtremalModuliArrayName)
+
+  /**
+   * @brief Setter property for CellExtremalModuliArrayName
+   */
+  void setCellExtremalModuliArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellExtremalModuliArrayName
+   * @return Value of CellExtremalModuliArrayName
+   */
+  QString getCellExtremalModuliArrayName() const;
+
+  Q_PROPERTY(QString CellExtremalModuliArrayName READ getCellExtremalModuliArrayName WRITE setCellExtremalModuliArrayName)
+
+  /**
+   * @brief Setter property for ExtremalDirectionsArrayName
+   */
+  void setExtremalDirectionsArrayName(const QString& value);
+  /**
+   * @brief Getter property for ExtremalDirectionsArrayName
+   * @return Value of ExtremalDirectionsArrayName
+   */
+  QString getExtremalDirectionsArrayName() const;
+
+  Q_PROPERTY(QString ExtremalDirectionsArrayName READ getExtremalDirectionsArrayName WRITE setExtremalDirectionsArrayName)
+
+  /**
+   * @brief Setter property for CellExtremalDirectionsArrayName
+   */
+  void setCellExtremalDirectionsArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellExtremalDirectionsArrayName
+   * @return Value of CellExtremalDirectionsArrayName
+   */
+  QString getCellExtremalDirectionsArrayName() const;
+
+  Q_PROPERTY(QString CellExtremalDirectionsArrayName READ getCellExtremalDirectionsArrayName WRITE setCellExtremalDirectionsArrayName)
+
+  /**
+   * @brief Setter property for AnisotropyRatiosArrayName
+   */
+  void setAnisotropyRatiosArrayName(const QString& value);
+  /**
+   * @brief Getter property for AnisotropyRatiosArrayName
+   * @return Value of AnisotropyRatiosArrayName
+   */
+  QString getAnisotropyRatiosArrayName() const;
+
+  Q_PROPERTY(QString AnisotropyRatiosArrayName READ getAnisotropyRatiosArrayName WRITE setAnisotropyRatiosArrayName)
+
+  /**
+   * @brief Setter property for CellAnisotropyRatiosArrayName
+   */
+  void setCellAnisotropyRatiosArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellAnisotropyRatiosArrayName
+   * @return Value of CellAnisotropyRatiosArrayName
+   */
+  QString getCellAnisotropyRatiosArrayName() const;
+
+  Q_PROPERTY(QString CellAnisotropyRatiosArrayName READ getCellAnisotropyRatiosArrayName WRITE setCellAnisotropyRatiosArrayName)
+
+  /**
+   * @brief Setter property for ComputeShearAndPoisson
+   */
+  void setComputeShearAndPoisson(bool value);
+  /**
+   * @brief Getter property for ComputeShearAndPoisson
+   * @return Value of ComputeShearAndPoisson
+   */
+  bool getComputeShearAndPoisson() const;
+
+  Q_PROPERTY(bool ComputeShearAndPoisson READ getComputeShearAndPoisson WRITE setComputeShearAndPoisson)
+
+  /**
+   * @brief Setter property for TransverseDirection
+   */
+  void setTransverseDirection(const FloatVec3Type& value);
+  /**
+   * @brief Getter property for TransverseDirection
+   * @return Value of TransverseDirection
+   */
+  FloatVec3Type getTransverseDirection() const;
+
+  Q_PROPERTY(FloatVec3Type TransverseDirection READ getTransverseDirection WRITE setTransverseDirection)
+
+  /**
+   * @brief Setter property for ShearModuliArrayName
+   */
+  void setShearModuliArrayName(const QString& value);
+  /**
+   * @brief Getter property for ShearModuliArrayName
+   * @return Value of ShearModuliArrayName
+   */
+  QString getShearModuliArrayName() const;
+
+  Q_PROPERTY(QString ShearModuliArrayName READ getShearModuliArrayName WRITE setShearModuliArrayName)
+
+  /**
+   * @brief Setter property for CellShearModuliArrayName
+   */
+  void setCellShearModuliArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellShearModuliArrayName
+   * @return Value of CellShearModuliArrayName
+   */
+  QString getCellShearModuliArrayName() const;
+
+  Q_PROPERTY(QString CellShearModuliArrayName READ getCellShearModuliArrayName WRITE setCellShearModuliArrayName)
+
+  /**
+   * @brief Setter property for PoissonRatiosArrayName
+   */
+  void setPoissonRatiosArrayName(const QString& value);
+  /**
+   * @brief Getter property for PoissonRatiosArrayName
+   * @return Value of PoissonRatiosArrayName
+   */
+  QString getPoissonRatiosArrayName() const;
+
+  Q_PROPERTY(QString PoissonRatiosArrayName READ getPoissonRatiosArrayName WRITE setPoissonRatiosArrayName)
+
+  /**
+   * @brief Setter property for CellPoissonRatiosArrayName
+   */
+  void setCellPoissonRatiosArrayName(const QString& value);
+  /**
+   * @brief Getter property for CellPoissonRatiosArrayName
+   * @return Value of CellPoissonRatiosArrayName
+   */
+  QString getCellPoissonRatiosArrayName() const;
+
+  Q_PROPERTY(QString CellPoissonRatiosArrayName READ getCellPoissonRatiosArrayName WRITE setCellPoissonRatiosArrayName)
+
+  /**
+   * @brief Setter property for IncrementalUpdate
+   */
+  void setIncrementalUpdate(bool value);
+  /**
+   * @brief Getter property for IncrementalUpdate
+   * @return Value of IncrementalUpdate
+   */
+  bool getIncrementalUpdate() const;
+
+  Q_PROPERTY(bool IncrementalUpdate READ getIncrementalUpdate WRITE setIncrementalUpdate)
+
+  /**
+   * @brief Getter for the number of features (or elements) evaluated by the last execute. With IncrementalUpdate
+   * only the ones whose inputs changed since the previous execute are evaluated
+   * @return Number of recomputed features (or elements)
+   */
+  size_t getNumberOfRecomputedTuples() const;
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -233,6 +539,24 @@ private:
   unsigned int* m_CrystalStructures = nullptr;
   std::weak_ptr<DataArray<float>> m_CrystalCompliancesPtr;
   float* m_CrystalCompliances = nullptr;
+  std::weak_ptr<DataArray<float>> m_LoadingDirectionsPtr;
+  float* m_LoadingDirections = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_CellPhasesPtr;
+  int32_t* m_CellPhases = nullptr;
+  std::weak_ptr<DataArray<float>> m_CellQuatsPtr;
+  float* m_CellQuats = nullptr;
+  std::weak_ptr<DataArray<float>> m_SampleCompliancesPtr;
+  float* m_SampleCompliances = nullptr;
+  std::weak_ptr<DataArray<float>> m_ExtremalModuliPtr;
+  float* m_ExtremalModuli = nullptr;
+  std::weak_ptr<DataArray<float>> m_ExtremalDirectionsPtr;
+  float* m_ExtremalDirections = nullptr;
+  std::weak_ptr<DataArray<float>> m_AnisotropyRatiosPtr;
+  float* m_AnisotropyRatios = nullptr;
+  std::weak_ptr<DataArray<float>> m_ShearModuliPtr;
+  float* m_ShearModuli = nullptr;
+  std::weak_ptr<DataArray<float>> m_PoissonRatiosPtr;
+  float* m_PoissonRatios = nullptr;
 
   DataArrayPath m_FeaturePhasesArrayPath = {"", "", ""};
   DataArrayPath m_CrystalStructuresArrayPath = {"", "", ""};
@@ -240,6 +564,35 @@ private:
   DataArrayPath m_AvgQuatsArrayPath = {"", "", ""};
   QString m_DirectionalModuliArrayName = {"DirectionalModuli"};
   FloatVec3Type m_LoadingDirection = {};
+  bool m_UseLoadingDirectionsArray = {false};
+  DataArrayPath m_LoadingDirectionsArrayPath = {"", "", ""};
+  int m_OrientationLevel = {0};
+  DataArrayPath m_CellPhasesArrayPath = {"", "", ""};
+  DataArrayPath m_CellQuatsArrayPath = {"", "", ""};
+  QString m_CellDirectionalModuliArrayName = {"DirectionalModuli"};
+  bool m_ComputeSampleCompliances = {false};
+  QString m_SampleCompliancesArrayName = {"SampleCompliances"};
+  QString m_CellSampleCompliancesArrayName = {"SampleCompliances"};
+  bool m_FindExtremalModuli = {false};
+  QString m_ExtremalModuliArrayName = {"ExtremalModuli"};
+  QString m_CellExtremalModuliArrayName = {"ExtremalModuli"};
+  QString m_ExtremalDirectionsArrayName = {"ExtremalDirections"};
+  QString m_CellExtremalDirectionsArrayName = {"ExtremalDirections"};
+  QString m_AnisotropyRatiosArrayName = {"AnisotropyRatios"};
+  QString m_CellAnisotropyRatiosArrayName = {"AnisotropyRatios"};
+  bool m_ComputeShearAndPoisson = {false};
+  FloatVec3Type m_TransverseDirection = {};
+  QString m_ShearModuliArrayName = {"ShearModuli"};
+  QString m_CellShearModuliArrayName = {"ShearModuli"};
+  QString m_PoissonRatiosArrayName = {"PoissonRatios"};
+  QString m_CellPoissonRatiosArrayName = {"PoissonRatios"};
+  bool m_IncrementalUpdate = {false};
+
+  // fingerprints and outputs of the previous execute (only kept with IncrementalUpdate)
+  uint64_t m_PreviousSettingsFingerprint = 0;
+  std::vector<uint64_t> m_PreviousFingerprints;
+  std::vector<std::vector<float>> m_PreviousOutputs;
+  size_t m_NumberOfRecomputedTuples = 0;
 
 public:
   FindDirectionalModuli(const FindDirectionalModuli&) = delete;            // Copy Constructor Not Implemented
@@ -15,69 +15,363 @@
  *                                                                                               *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
+#include "H5Support/H5Utilities.h"
+
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "UCSBUtilities/UCSBUtilitiesConstants.h"
 #include "UCSBUtilities/UCSBUtilitiesVersion.h"
+#include "UCSBUtilitiesFilters/util/DirectionalModulusKernels.h"
 
 #include "FindModulusMismatch.h"
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 #include <tbb/partitioner.h>
 #endif
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
+  AttributeMatrixID21 = 21,
+  AttributeMatrixID22 = 22,
+
   DataArrayID30 = 30,
   DataArrayID31 = 31,
+  DataArrayID32 = 32,
+  DataArrayID33 = 33,
+  DataArrayID34 = 34,
+  DataArrayID35 = 35,
+  DataArrayID36 = 36,
+  DataArrayID37 = 37,
+  DataArrayID38 = 38,
+  DataArrayID39 = 39,
 };
 
+namespace
+{
+constexpr size_t k_GrainSize = 64 * DirectionalModulusKernels::k_BlockSize; // smallest range handed to a thread
+constexpr size_t k_PairChunkSize = 1 << 16;                                 // triangles per chunk when collecting unique feature pairs
+constexpr std::array<float, 5> k_Percentiles = {5.0f, 25.0f, 50.0f, 75.0f, 95.0f}; // percentiles of the mismatch statistics
+
+/**
+ * @brief Packs the features on either side of a triangle into an order independent key (smaller feature in the high bits)
+ * @param feature1 Feature on one side
+ * @param feature2 Feature on the other side
+ * @return Key of the feature pair or 0 if either side isn't a feature
+ */
+uint64_t FeaturePairKey(int32_t feature1, int32_t feature2)
+{
+  if(feature1 <= 0 || feature2 <= 0)
+  {
+    return 0;
+  }
+  uint64_t low = static_cast<uint64_t>(std::min(feature1, feature2));
+  uint64_t high = static_cast<uint64_t>(std::max(feature1, feature2));
+  return (low << 32) | high;
+}
+
+/**
+ * @brief Computes |modulus1 - modulus2| in the native type of the moduli, integer differences are taken in the unsigned
+ * type of the same width so they can't overflow
+ */
+template <typename T>
+float AbsoluteDifference(T modulus1, T modulus2)
+{
+  if constexpr(std::is_floating_point<T>::value)
+  {
+    return static_cast<float>(modulus1 > modulus2 ? modulus1 - modulus2 : modulus2 - modulus1);
+  }
+  else
+  {
+    using UnsignedType = typename std::make_unsigned<T>::type;
+    UnsignedType delta = modulus1 > modulus2 ? static_cast<UnsignedType>(modulus1) - static_cast<UnsignedType>(modulus2) : static_cast<UnsignedType>(modulus2) - static_cast<UnsignedType>(modulus1);
+    return static_cast<float>(delta);
+  }
+}
+} // namespace
+
+/**
+ * @brief The FindModulusMismatchImpl class implements a threaded algorithm that computes the absolute difference of the
+ * precomputed moduli of the features on either side of each triangle. It is instantiated for every supported moduli and
+ * label type so the arrays are read in place. Every component of the moduli is differenced from a single read of each
+ * triangle's labels, so N properties or loading directions cost one pass over the labels instead of N.
+ */
+template <typename ModuliType, typename LabelType>
 class FindModulusMismatchImpl
 {
-  int32_t* m_Labels;
-  float* m_Moduli;
+  const LabelType* m_Labels;
+  const ModuliType* m_Moduli;
+  size_t m_NumComponents;
   float* m_DeltaModuli;
 
 public:
-  FindModulusMismatchImpl(int32_t* labels, float* mod, float* deltaMod)
+  FindModulusMismatchImpl(const LabelType* labels, const ModuliType* mod, size_t numComponents, float* deltaMod)
   : m_Labels(labels)
   , m_Moduli(mod)
+  , m_NumComponents(numComponents)
   , m_DeltaModuli(deltaMod)
   {
   }
 
   virtual ~FindModulusMismatchImpl() = default;
 
-  void generate(size_t start, size_t end) const
+  /**
+   * @brief Returns true if triangle i separates two features
+   */
+  bool separatesFeatures(size_t i) const
+  {
+    return m_Labels[2 * i] > 0 && m_Labels[2 * i + 1] > 0;
+  }
+
+  /**
+   * @brief Computes the mismatch of triangles [start, end) into deltaModuli (which holds triangle start first)
+   */
+  void evaluate(size_t start, size_t end, float* deltaModuli) const
   {
-    int feature1, feature2;
-    float deltaE;
+    LabelType feature1, feature2;
 
     for(size_t i = start; i < end; i++)
     {
       feature1 = m_Labels[2 * i];
       feature2 = m_Labels[2 * i + 1];
-      deltaE = 0.0f;
+      float* deltaE = deltaModuli + (i - start) * m_NumComponents;
       if(feature1 > 0 && feature2 > 0)
       {
-        deltaE = m_Moduli[feature1] - m_Moduli[feature2];
-        if(deltaE < 0)
+        const ModuliType* moduli1 = m_Moduli + static_cast<size_t>(feature1) * m_NumComponents;
+        const ModuliType* moduli2 = m_Moduli + static_cast<size_t>(feature2) * m_NumComponents;
+        for(size_t c = 0; c < m_NumComponents; c++)
+        {
+          deltaE[c] = AbsoluteDifference(moduli1[c], moduli2[c]);
+        }
+      }
+      else
+      {
+        std::fill(deltaE, deltaE + m_NumComponents, 0.0f);
+      }
+    }
+  }
+
+  void generate(size_t start, size_t end) const
+  {
+    evaluate(start, end, m_DeltaModuli + start * m_NumComponents);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The FindNormalModulusMismatchImpl class implements a threaded algorithm that computes the modulus mismatch of
+ * each triangle with both moduli measured along the triangle's normal. Triangles are processed in blocks: the normals and
+ * the average orientations of the features on either side are gathered into structure of arrays form, the normal is
+ * rotated into each crystal frame and each side is evaluated once per phase present in the block with that phase's kernel.
+ */
+class FindNormalModulusMismatchImpl
+{
+  using ComplianceCoefficients = DirectionalModulusKernels::ComplianceCoefficients;
+  using ElasticSymmetry = DirectionalModulusKernels::ElasticSymmetry;
+
+  int32_t* m_Labels;
+  double* m_Normals;
+  int32_t* m_Phases;
+  float* m_Quats;
+  unsigned int* m_CrystalStructures;
+  const std::vector<ComplianceCoefficients>& m_Coefficients;
+  const std::vector<ElasticSymmetry>& m_Symmetries;
+  float* m_DeltaModuli;
+
+public:
+  FindNormalModulusMismatchImpl(int32_t* labels, double* normals, int32_t* phases, float* quats, unsigned int* crystalStructures, const std::vector<ComplianceCoefficients>& coefficients,
+                                const std::vector<ElasticSymmetry>& symmetries, float* deltaMod)
+  : m_Labels(labels)
+  , m_Normals(normals)
+  , m_Phases(phases)
+  , m_Quats(quats)
+  , m_CrystalStructures(crystalStructures)
+  , m_Coefficients(coefficients)
+  , m_Symmetries(symmetries)
+  , m_DeltaModuli(deltaMod)
+  {
+  }
+
+  virtual ~FindNormalModulusMismatchImpl() = default;
+
+  /**
+   * @brief Returns true if triangle i separates two features
+   */
+  bool separatesFeatures(size_t i) const
+  {
+    return m_Labels[2 * i] > 0 && m_Labels[2 * i + 1] > 0;
+  }
+
+  /**
+   * @brief Computes the mismatch of triangles [start, end) into deltaModuli (which holds triangle start first)
+   */
+  void evaluate(size_t start, size_t end, float* deltaModuli) const
+  {
+    constexpr size_t k_BlockSize = DirectionalModulusKernels::k_BlockSize;
+
+    std::array<float, k_BlockSize> nx;
+    std::array<float, k_BlockSize> ny;
+    std::array<float, k_BlockSize> nz;
+    std::array<std::array<float, k_BlockSize>, 2> qx;
+    std::array<std::array<float, k_BlockSize>, 2> qy;
+    std::array<std::array<float, k_BlockSize>, 2> qz;
+    std::array<std::array<float, k_BlockSize>, 2> qw;
+    std::array<std::array<int32_t, k_BlockSize>, 2> phases;
+    std::array<std::array<float, k_BlockSize>, 2> sideModuli;
+    std::array<float, k_BlockSize> a;
+    std::array<float, k_BlockSize> b;
+    std::array<float, k_BlockSize> c;
+    std::array<float, k_BlockSize> moduli;
+    std::array<int32_t, k_BlockSize> blockPhases;
+
+    for(size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
+    {
+      size_t count = std::min(k_BlockSize, end - blockStart);
+
+      // gather the normal and the orientation + phase of both features (lanes with a non feature or unknown structure get phase -1)
+      for(size_t i = 0; i < count; i++)
+      {
+        const double* normal = m_Normals + 3 * (blockStart + i);
+        float length = static_cast<float>(std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]));
+        float scale = length > 0.0f ? 1.0f / length : 0.0f;
+        nx[i] = static_cast<float>(normal[0]) * scale;
+        ny[i] = static_cast<float>(normal[1]) * scale;
+        nz[i] = static_cast<float>(normal[2]) * scale;
+
+        int32_t feature1 = m_Labels[2 * (blockStart + i)];
+        int32_t feature2 = m_Labels[2 * (blockStart + i) + 1];
+        bool valid = feature1 > 0 && feature2 > 0;
+        for(size_t side = 0; side < 2; side++)
+        {
+          int32_t feature = valid ? (0 == side ? feature1 : feature2) : 0;
+          const float* avgQuatPtr = m_Quats + 4 * feature;
+          qx[side][i] = avgQuatPtr[0];
+          qy[side][i] = avgQuatPtr[1];
+          qz[side][i] = avgQuatPtr[2];
+          qw[side][i] = avgQuatPtr[3];
+          int32_t phase = m_Phases[feature];
+          phases[side][i] = (valid && m_CrystalStructures[phase] < EbsdLib::CrystalStructure::LaueGroupEnd) ? phase : -1;
+        }
+      }
+
+      // rotate the normal into the crystal frame of each side and evaluate it once per phase present on that side
+      for(size_t side = 0; side < 2; side++)
+      {
+        DirectionalModulusKernels::CrystalFrameDirections(qx[side].data(), qy[side].data(), qz[side].data(), qw[side].data(), count, nx.data(), ny.data(), nz.data(), a.data(), b.data(),
+                                                          c.data());
+        size_t numBlockPhases = 0;
+        for(size_t i = 0; i < count; i++)
+        {
+          int32_t phase = phases[side][i];
+          if(phase >= 0 && std::find(blockPhases.begin(), blockPhases.begin() + numBlockPhases, phase) == blockPhases.begin() + numBlockPhases)
+          {
+            blockPhases[numBlockPhases++] = phase;
+          }
+          sideModuli[side][i] = 0.0f;
+        }
+        for(size_t p = 0; p < numBlockPhases; p++)
+        {
+          int32_t phase = blockPhases[p];
+          DirectionalModulusKernels::SymmetryModuli(m_Symmetries[phase], a.data(), b.data(), c.data(), count, m_Coefficients[phase], moduli.data());
+          for(size_t i = 0; i < count; i++)
+          {
+            sideModuli[side][i] = phases[side][i] == phase ? moduli[i] : sideModuli[side][i];
+          }
+        }
+      }
+
+      for(size_t i = 0; i < count; i++)
+      {
+        bool valid = phases[0][i] >= 0 && phases[1][i] >= 0;
+        deltaModuli[blockStart - start + i] = valid ? std::fabs(sideModuli[0][i] - sideModuli[1][i]) : 0.0f;
+      }
+    }
+  }
+
+  void generate(size_t start, size_t end) const
+  {
+    evaluate(start, end, m_DeltaModuli + start);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The FindFeaturePairsImpl class implements a threaded algorithm that collects the sorted unique feature pair keys
+ * of fixed size chunks of triangles. Neighboring triangles usually belong to the same boundary so repeats of the previous
+ * key are skipped before sorting.
+ */
+class FindFeaturePairsImpl
+{
+  int32_t* m_Labels;
+  size_t m_NumTriangles;
+  std::vector<std::vector<uint64_t>>& m_ChunkKeys;
+
+public:
+  FindFeaturePairsImpl(int32_t* labels, size_t numTriangles, std::vector<std::vector<uint64_t>>& chunkKeys)
+  : m_Labels(labels)
+  , m_NumTriangles(numTriangles)
+  , m_ChunkKeys(chunkKeys)
+  {
+  }
+
+  virtual ~FindFeaturePairsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t chunk = start; chunk < end; chunk++)
+    {
+      std::vector<uint64_t>& keys = m_ChunkKeys[chunk];
+      size_t chunkEnd = std::min(m_NumTriangles, (chunk + 1) * k_PairChunkSize);
+      uint64_t previous = 0;
+      for(size_t i = chunk * k_PairChunkSize; i < chunkEnd; i++)
+      {
+        uint64_t key = FeaturePairKey(m_Labels[2 * i], m_Labels[2 * i + 1]);
+        if(key != previous && 0 != key)
         {
-          deltaE = -deltaE;
+          keys.push_back(key);
         }
+        previous = key;
       }
-      m_DeltaModuli[i] = deltaE;
+      std::sort(keys.begin(), keys.end());
+      keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
     }
   }
 
@@ -89,6 +383,423 @@ public:
 #endif
 };
 
+/**
+ * @brief The FindFeatureFaceIdsImpl class implements a threaded algorithm that looks up the index of each triangle's
+ * feature pair in the sorted unique pairs (0 for triangles that don't separate two features).
+ */
+class FindFeatureFaceIdsImpl
+{
+  int32_t* m_Labels;
+  const std::vector<uint64_t>& m_Pairs;
+  int32_t* m_FeatureFaceIds;
+
+public:
+  FindFeatureFaceIdsImpl(int32_t* labels, const std::vector<uint64_t>& pairs, int32_t* featureFaceIds)
+  : m_Labels(labels)
+  , m_Pairs(pairs)
+  , m_FeatureFaceIds(featureFaceIds)
+  {
+  }
+
+  virtual ~FindFeatureFaceIdsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    uint64_t previousKey = 0;
+    int32_t previousId = 0;
+    for(size_t i = start; i < end; i++)
+    {
+      uint64_t key = FeaturePairKey(m_Labels[2 * i], m_Labels[2 * i + 1]);
+      if(key != previousKey)
+      {
+        previousKey = key;
+        previousId = 0 == key ? 0 : static_cast<int32_t>(std::lower_bound(m_Pairs.begin(), m_Pairs.end(), key) - m_Pairs.begin()) + 1;
+      }
+      m_FeatureFaceIds[i] = previousId;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The FeatureFaceMismatchLookup class provides the per triangle mismatch when it is computed once per feature pair
+ * (each triangle takes the mismatch of its pair) so the statistics see every triangle of a pair.
+ */
+class FeatureFaceMismatchLookup
+{
+  int32_t* m_FeatureFaceIds;
+  const float* m_FeatureFaceDeltaModuli;
+  size_t m_NumComponents;
+
+public:
+  FeatureFaceMismatchLookup(int32_t* featureFaceIds, const float* featureFaceDeltaModuli, size_t numComponents)
+  : m_FeatureFaceIds(featureFaceIds)
+  , m_FeatureFaceDeltaModuli(featureFaceDeltaModuli)
+  , m_NumComponents(numComponents)
+  {
+  }
+
+  bool separatesFeatures(size_t i) const
+  {
+    return m_FeatureFaceIds[i] > 0;
+  }
+
+  void evaluate(size_t start, size_t end, float* deltaModuli) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      const float* pairDelta = m_FeatureFaceDeltaModuli + static_cast<size_t>(m_FeatureFaceIds[i]) * m_NumComponents;
+      std::copy(pairDelta, pairDelta + m_NumComponents, deltaModuli + (i - start) * m_NumComponents);
+    }
+  }
+};
+
+/**
+ * @brief The MismatchStatisticsImpl class implements a threaded reduction that accumulates the area weighted distribution
+ * of the mismatch in the same pass that computes it. Blocks of triangles are evaluated by the kernel (into the per triangle
+ * output if it is stored, otherwise into a small scratch buffer) and binned into a histogram per component; every thread
+ * accumulates its own histograms and moments which are summed when the threads are joined. Only triangles that separate
+ * two features contribute.
+ */
+template <typename KernelType>
+class MismatchStatisticsImpl
+{
+  const KernelType& m_Kernel;
+  const double* m_Areas;
+  size_t m_NumComponents;
+  size_t m_NumBins;
+  std::vector<float> m_BinScales;
+  float* m_DeltaModuli;
+
+  double m_TotalArea = 0.0;
+  std::vector<double> m_Histograms;
+  std::vector<double> m_FirstMoments;
+  std::vector<double> m_SecondMoments;
+
+public:
+  MismatchStatisticsImpl(const KernelType& kernel, const double* areas, size_t numComponents, size_t numBins, const std::vector<float>& maxima, float* deltaModuli)
+  : m_Kernel(kernel)
+  , m_Areas(areas)
+  , m_NumComponents(numComponents)
+  , m_NumBins(numBins)
+  , m_BinScales(numComponents, 0.0f)
+  , m_DeltaModuli(deltaModuli)
+  , m_Histograms(numComponents * numBins, 0.0)
+  , m_FirstMoments(numComponents, 0.0)
+  , m_SecondMoments(numComponents, 0.0)
+  {
+    for(size_t c = 0; c < numComponents; c++)
+    {
+      m_BinScales[c] = maxima[c] > 0.0f ? static_cast<float>(numBins) / maxima[c] : 0.0f;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  MismatchStatisticsImpl(MismatchStatisticsImpl& other, tbb::split)
+  : m_Kernel(other.m_Kernel)
+  , m_Areas(other.m_Areas)
+  , m_NumComponents(other.m_NumComponents)
+  , m_NumBins(other.m_NumBins)
+  , m_BinScales(other.m_BinScales)
+  , m_DeltaModuli(other.m_DeltaModuli)
+  , m_Histograms(other.m_Histograms.size(), 0.0)
+  , m_FirstMoments(other.m_NumComponents, 0.0)
+  , m_SecondMoments(other.m_NumComponents, 0.0)
+  {
+  }
+#endif
+
+  virtual ~MismatchStatisticsImpl() = default;
+
+  void generate(size_t start, size_t end)
+  {
+    constexpr size_t k_BlockSize = DirectionalModulusKernels::k_BlockSize;
+    std::vector<float> scratch(nullptr == m_DeltaModuli ? k_BlockSize * m_NumComponents : 0);
+    size_t lastBin = m_NumBins - 1;
+
+    for(size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
+    {
+      size_t blockEnd = std::min(end, blockStart + k_BlockSize);
+      float* deltaModuli = nullptr == m_DeltaModuli ? scratch.data() : m_DeltaModuli + blockStart * m_NumComponents;
+      m_Kernel.evaluate(blockStart, blockEnd, deltaModuli);
+
+      for(size_t i = blockStart; i < blockEnd; i++)
+      {
+        if(!m_Kernel.separatesFeatures(i))
+        {
+          continue;
+        }
+        double area = m_Areas[i];
+        m_TotalArea += area;
+        const float* deltaE = deltaModuli + (i - blockStart) * m_NumComponents;
+        for(size_t c = 0; c < m_NumComponents; c++)
+        {
+          double delta = deltaE[c];
+          m_FirstMoments[c] += area * delta;
+          m_SecondMoments[c] += area * delta * delta;
+          // values beyond the upper bound (or NaN) land in the last bin
+          float position = deltaE[c] * m_BinScales[c];
+          size_t bin = position < static_cast<float>(lastBin) ? static_cast<size_t>(position) : lastBin;
+          m_Histograms[c * m_NumBins + bin] += area;
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    generate(r.begin(), r.end());
+  }
+
+  void join(const MismatchStatisticsImpl& other)
+  {
+    m_TotalArea += other.m_TotalArea;
+    for(size_t j = 0; j < m_Histograms.size(); j++)
+    {
+      m_Histograms[j] += other.m_Histograms[j];
+    }
+    for(size_t c = 0; c < m_NumComponents; c++)
+    {
+      m_FirstMoments[c] += other.m_FirstMoments[c];
+      m_SecondMoments[c] += other.m_SecondMoments[c];
+    }
+  }
+#endif
+
+  /**
+   * @brief Writes the area fraction histogram, its bounds, the mean, the variance and the percentiles (interpolated
+   * within the histogram bins) of each component
+   */
+  void finalize(const std::vector<float>& maxima, float* histograms, float* bounds, float* means, float* variances, float* percentiles) const
+  {
+    double scale = m_TotalArea > 0.0 ? 1.0 / m_TotalArea : 0.0;
+    for(size_t c = 0; c < m_NumComponents; c++)
+    {
+      const double* histogram = m_Histograms.data() + c * m_NumBins;
+      double binWidth = static_cast<double>(maxima[c]) / static_cast<double>(m_NumBins);
+      for(size_t j = 0; j < m_NumBins; j++)
+      {
+        histograms[c * m_NumBins + j] = static_cast<float>(histogram[j] * scale);
+      }
+      bounds[2 * c] = 0.0f;
+      bounds[2 * c + 1] = maxima[c];
+
+      double mean = m_FirstMoments[c] * scale;
+      means[c] = static_cast<float>(mean);
+      variances[c] = static_cast<float>(std::max(0.0, m_SecondMoments[c] * scale - mean * mean));
+
+      size_t bin = 0;
+      double cumulative = 0.0;
+      for(size_t p = 0; p < k_Percentiles.size(); p++)
+      {
+        double target = m_TotalArea * k_Percentiles[p] / 100.0;
+        while(bin + 1 < m_NumBins && cumulative + histogram[bin] < target)
+        {
+          cumulative += histogram[bin++];
+        }
+        double fraction = histogram[bin] > 0.0 ? std::min(1.0, (target - cumulative) / histogram[bin]) : 0.0;
+        percentiles[c * k_Percentiles.size() + p] = static_cast<float>((static_cast<double>(bin) + fraction) * binWidth);
+      }
+    }
+  }
+};
+
+namespace
+{
+/**
+ * @brief The MismatchStatisticsOutputs struct holds the inputs and outputs of the optional statistics pass
+ */
+struct MismatchStatisticsOutputs
+{
+  const double* areas = nullptr;
+  size_t numBins = 0;
+  float* histograms = nullptr;
+  float* bounds = nullptr;
+  float* means = nullptr;
+  float* variances = nullptr;
+  float* percentiles = nullptr;
+};
+
+/**
+ * @brief Computes the mismatch of count triangles with kernel while accumulating its statistics
+ * @param maxima Upper bound of the histogram of each component
+ * @param deltaModuli Per triangle output (may be nullptr)
+ */
+template <typename KernelType>
+void FindMismatchStatistics(const KernelType& kernel, size_t numComponents, const std::vector<float>& maxima, float* deltaModuli, size_t count, const MismatchStatisticsOutputs& outputs)
+{
+  MismatchStatisticsImpl<KernelType> impl(kernel, outputs.areas, numComponents, outputs.numBins, maxima, deltaModuli);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(true)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, count, k_GrainSize), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.generate(0, count);
+  }
+  impl.finalize(maxima, outputs.histograms, outputs.bounds, outputs.means, outputs.variances, outputs.percentiles);
+}
+
+/**
+ * @brief Runs FindModulusMismatchImpl over count triangles if the moduli are a DataArray<ModuliType>. If statistics are
+ * requested the histogram of each component spans the range of that component over the features.
+ * @return true if the moduli had the requested type
+ */
+template <typename ModuliType, typename LabelType>
+bool FindModulusMismatchTyped(const IDataArray::Pointer& moduliArray, const LabelType* labels, float* deltaModuli, size_t count, const MismatchStatisticsOutputs* statistics)
+{
+  typename DataArray<ModuliType>::Pointer moduliPtr = std::dynamic_pointer_cast<DataArray<ModuliType>>(moduliArray);
+  if(nullptr == moduliPtr.get())
+  {
+    return false;
+  }
+
+  size_t numComponents = moduliPtr->getNumberOfComponents();
+  FindModulusMismatchImpl<ModuliType, LabelType> impl(labels, moduliPtr->getPointer(0), numComponents, deltaModuli);
+  if(nullptr != statistics)
+  {
+    const ModuliType* moduli = moduliPtr->getPointer(0);
+    size_t numFeatures = moduliPtr->getNumberOfTuples();
+    std::vector<float> maxima(numComponents, 0.0f);
+    for(size_t c = 0; c < numComponents && numFeatures > 1; c++)
+    {
+      std::pair<double, double> range(static_cast<double>(moduli[numComponents + c]), static_cast<double>(moduli[numComponents + c]));
+      for(size_t f = 2; f < numFeatures; f++)
+      {
+        double modulus = static_cast<double>(moduli[f * numComponents + c]);
+        range.first = std::min(range.first, modulus);
+        range.second = std::max(range.second, modulus);
+      }
+      maxima[c] = static_cast<float>(range.second - range.first);
+    }
+    FindMismatchStatistics(impl, numComponents, maxima, deltaModuli, count, *statistics);
+    return true;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.generate(0, count);
+  }
+  return true;
+}
+
+/**
+ * @brief Dispatches to the FindModulusMismatchImpl instantiation matching the type of the moduli
+ * @return false if the moduli aren't a supported primitive type
+ */
+template <typename LabelType>
+bool DispatchModulusMismatch(const IDataArray::Pointer& moduliArray, const LabelType* labels, float* deltaModuli, size_t count, const MismatchStatisticsOutputs* statistics = nullptr)
+{
+  return FindModulusMismatchTyped<float>(moduliArray, labels, deltaModuli, count, statistics) || FindModulusMismatchTyped<double>(moduliArray, labels, deltaModuli, count, statistics) ||
+         FindModulusMismatchTyped<int8_t>(moduliArray, labels, deltaModuli, count, statistics) || FindModulusMismatchTyped<uint8_t>(moduliArray, labels, deltaModuli, count, statistics) ||
+         FindModulusMismatchTyped<int16_t>(moduliArray, labels, deltaModuli, count, statistics) || FindModulusMismatchTyped<uint16_t>(moduliArray, labels, deltaModuli, count, statistics) ||
+         FindModulusMismatchTyped<int32_t>(moduliArray, labels, deltaModuli, count, statistics) || FindModulusMismatchTyped<uint32_t>(moduliArray, labels, deltaModuli, count, statistics) ||
+         FindModulusMismatchTyped<int64_t>(moduliArray, labels, deltaModuli, count, statistics) || FindModulusMismatchTyped<uint64_t>(moduliArray, labels, deltaModuli, count, statistics);
+}
+
+/**
+ * @brief The ScopedH5Id class closes an HDF5 file / dataset / dataspace / datatype / property list when it goes out of scope
+ */
+class ScopedH5Id
+{
+public:
+  ScopedH5Id(hid_t id, herr_t (*close)(hid_t))
+  : m_Id(id)
+  , m_Close(close)
+  {
+  }
+  ~ScopedH5Id()
+  {
+    if(m_Id >= 0)
+    {
+      m_Close(m_Id);
+    }
+  }
+  ScopedH5Id(const ScopedH5Id&) = delete;
+  ScopedH5Id& operator=(const ScopedH5Id&) = delete;
+
+  hid_t get() const
+  {
+    return m_Id;
+  }
+
+private:
+  hid_t m_Id;
+  herr_t (*m_Close)(hid_t);
+};
+
+/**
+ * @brief Reads the N x 2 face labels dataset in chunks of chunkSize triangles, computes the mismatch of each chunk with
+ * DispatchModulusMismatch and writes it to the N x numComponents delta dataset, so only one chunk of labels and deltas is resident
+ * @return 0 on success, 1 if the filter was canceled, -5 if the moduli aren't supported and -9 if a chunk couldn't be read or written
+ */
+template <typename LabelType>
+int StreamModulusMismatch(FindModulusMismatch* filter, const IDataArray::Pointer& moduliArray, hid_t labelsId, hid_t deltaId, int64_t numTriangles, size_t chunkSize)
+{
+  hid_t labelType = std::is_same<LabelType, int32_t>::value ? H5T_NATIVE_INT32 : H5T_NATIVE_INT64;
+  hsize_t numComponents = moduliArray->getNumberOfComponents();
+  std::vector<LabelType> labels(2 * chunkSize);
+  std::vector<float> deltaModuli(numComponents * chunkSize);
+
+  ScopedH5Id labelsSpace(H5Dget_space(labelsId), H5Sclose);
+  ScopedH5Id deltaSpace(H5Dget_space(deltaId), H5Sclose);
+  if(labelsSpace.get() < 0 || deltaSpace.get() < 0)
+  {
+    return -9;
+  }
+
+  for(int64_t start = 0; start < numTriangles; start += static_cast<int64_t>(chunkSize))
+  {
+    if(filter->getCancel())
+    {
+      return 1;
+    }
+
+    hsize_t count = static_cast<hsize_t>(std::min(static_cast<int64_t>(chunkSize), numTriangles - start));
+    hsize_t offset[2] = {static_cast<hsize_t>(start), 0};
+    hsize_t labelsCount[2] = {count, 2};
+    ScopedH5Id labelsMemory(H5Screate_simple(2, labelsCount, nullptr), H5Sclose);
+    if(H5Sselect_hyperslab(labelsSpace.get(), H5S_SELECT_SET, offset, nullptr, labelsCount, nullptr) < 0 ||
+       H5Dread(labelsId, labelType, labelsMemory.get(), labelsSpace.get(), H5P_DEFAULT, labels.data()) < 0)
+    {
+      return -9;
+    }
+
+    if(!DispatchModulusMismatch(moduliArray, labels.data(), deltaModuli.data(), count))
+    {
+      return -5;
+    }
+
+    hsize_t deltaCount[2] = {count, numComponents};
+    ScopedH5Id deltaMemory(H5Screate_simple(2, deltaCount, nullptr), H5Sclose);
+    if(H5Sselect_hyperslab(deltaSpace.get(), H5S_SELECT_SET, offset, nullptr, deltaCount, nullptr) < 0 ||
+       H5Dwrite(deltaId, H5T_NATIVE_FLOAT, deltaMemory.get(), deltaSpace.get(), H5P_DEFAULT, deltaModuli.data()) < 0)
+    {
+      return -9;
+    }
+
+    QString ss = QObject::tr("Processed %1 of %2 triangles").arg(start + static_cast<int64_t>(count)).arg(numTriangles);
+    filter->notifyStatusMessage(ss);
+  }
+  return 0;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -106,16 +817,83 @@ void FindModulusMismatch::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   {
-    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Category::Any);
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Moduli", ModuliArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req));
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Mismatch Direction");
+    parameter->setPropertyName("MismatchMode");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(FindModulusMismatch, this, MismatchMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(FindModulusMismatch, this, MismatchMode));
+    parameter->setDefaultValue(getMismatchMode());
+    std::vector<QString> choices = {"Precomputed Moduli", "Face Normals"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedChoiceProps = {"ModuliArrayPath", "SurfaceMeshFaceNormalsArrayPath", "FeaturePhasesArrayPath", "AvgQuatsArrayPath", "CrystalStructuresArrayPath", "CrystalCompliancesArrayPath"};
+    parameter->setLinkedProperties(linkedChoiceProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Category::Any);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Moduli", ModuliArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req, 0));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 2, AttributeMatrix::Category::Any);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("SurfaceMeshFaceLabels", SurfaceMeshFaceLabelsArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req));
   }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Double, 3, AttributeMatrix::Category::Element);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("SurfaceMeshFaceNormals", SurfaceMeshFaceNormalsArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req, 1));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Feature);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("FeaturePhases", FeaturePhasesArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req, 1));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Category::Feature);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("AvgQuats", AvgQuatsArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req, 1));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::UInt32, 1, AttributeMatrix::Category::Ensemble);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Crystal Structures", CrystalStructuresArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req, 1));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 36, AttributeMatrix::Category::Ensemble);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Single Crystal Compliances", CrystalCompliancesArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req, 1));
+  }
+
+  std::vector<QString> linkedProps = {"FaceFeatureAttributeMatrixName", "FeatureFaceLabelsArrayName", "FeatureFaceDeltaModulusArrayName", "SurfaceMeshFeatureFaceIdsArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compute Once Per Feature Pair", DeduplicatePairs, FilterParameter::Category::Parameter, FindModulusMismatch, linkedProps));
+  linkedProps = {"SurfaceMeshDeltaModulusArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Store Mismatch Per Triangle", StoreTriangleMismatch, FilterParameter::Category::Parameter, FindModulusMismatch, linkedProps));
+  linkedProps = {"SurfaceMeshFaceAreasArrayPath", "NumberOfBins", "MismatchStatisticsAttributeMatrixName", "MismatchHistogramArrayName", "MismatchHistogramBoundsArrayName",
+                 "MismatchMeanArrayName", "MismatchVarianceArrayName", "MismatchPercentilesArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compute Area Weighted Statistics", ComputeStatistics, FilterParameter::Category::Parameter, FindModulusMismatch, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Bins", NumberOfBins, FilterParameter::Category::Parameter, FindModulusMismatch));
+  linkedProps = {"StreamingInputFile", "StreamingFaceLabelsDatasetPath", "StreamingOutputFile", "StreamingDeltaModulusDatasetPath", "StreamingChunkSize"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Stream Triangles Through Files", StreamFromFile, FilterParameter::Category::Parameter, FindModulusMismatch, linkedProps));
+  parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Face Labels File", StreamingInputFile, FilterParameter::Category::Parameter, FindModulusMismatch, "*.dream3d *.h5 *.hdf5", "HDF5 File"));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Face Labels Dataset", StreamingFaceLabelsDatasetPath, FilterParameter::Category::Parameter, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Delta Modulus File", StreamingOutputFile, FilterParameter::Category::Parameter, FindModulusMismatch, "*.h5 *.hdf5", "HDF5 File"));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Delta Modulus Dataset", StreamingDeltaModulusDatasetPath, FilterParameter::Category::Parameter, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Triangles per Chunk", StreamingChunkSize, FilterParameter::Category::Parameter, FindModulusMismatch));
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Double, 1, AttributeMatrix::Category::Element);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("SurfaceMeshFaceAreas", SurfaceMeshFaceAreasArrayPath, FilterParameter::Category::RequiredArray, FindModulusMismatch, req));
+  }
 
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("SurfaceMeshDeltaModulus", SurfaceMeshDeltaModulusArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath,
                                                       FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Face Feature Attribute Matrix", FaceFeatureAttributeMatrixName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Feature Face Labels", FeatureFaceLabelsArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Feature Face Delta Modulus", FeatureFaceDeltaModulusArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("SurfaceMeshFeatureFaceIds", SurfaceMeshFeatureFaceIdsArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath,
+                                                      FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Mismatch Statistics Attribute Matrix", MismatchStatisticsAttributeMatrixName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Area Histogram", MismatchHistogramArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Histogram Bounds", MismatchHistogramBoundsArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Mean", MismatchMeanArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Variance", MismatchVarianceArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Percentiles", MismatchPercentilesArrayName, FilterParameter::Category::CreatedArray, FindModulusMismatch));
 
   setFilterParameters(parameters);
 }
@@ -126,6 +904,33 @@ void FindModulusMismatch::readFilterParameters(AbstractFilterParametersReader* r
   setSurfaceMeshDeltaModulusArrayName(reader->readString("SurfaceMeshDeltaModulusArrayName", getSurfaceMeshDeltaModulusArrayName()));
   setSurfaceMeshFaceLabelsArrayPath(reader->readDataArrayPath("SurfaceMeshFaceLabelsArrayPath", getSurfaceMeshFaceLabelsArrayPath()));
   setModuliArrayPath(reader->readDataArrayPath("ModuliArrayPath", getModuliArrayPath()));
+  setMismatchMode(reader->readValue("MismatchMode", getMismatchMode()));
+  setSurfaceMeshFaceNormalsArrayPath(reader->readDataArrayPath("SurfaceMeshFaceNormalsArrayPath", getSurfaceMeshFaceNormalsArrayPath()));
+  setFeaturePhasesArrayPath(reader->readDataArrayPath("FeaturePhasesArrayPath", getFeaturePhasesArrayPath()));
+  setAvgQuatsArrayPath(reader->readDataArrayPath("AvgQuatsArrayPath", getAvgQuatsArrayPath()));
+  setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath()));
+  setCrystalCompliancesArrayPath(reader->readDataArrayPath("CrystalCompliancesArrayPath", getCrystalCompliancesArrayPath()));
+  setDeduplicatePairs(reader->readValue("DeduplicatePairs", getDeduplicatePairs()));
+  setFaceFeatureAttributeMatrixName(reader->readString("FaceFeatureAttributeMatrixName", getFaceFeatureAttributeMatrixName()));
+  setFeatureFaceLabelsArrayName(reader->readString("FeatureFaceLabelsArrayName", getFeatureFaceLabelsArrayName()));
+  setFeatureFaceDeltaModulusArrayName(reader->readString("FeatureFaceDeltaModulusArrayName", getFeatureFaceDeltaModulusArrayName()));
+  setSurfaceMeshFeatureFaceIdsArrayName(reader->readString("SurfaceMeshFeatureFaceIdsArrayName", getSurfaceMeshFeatureFaceIdsArrayName()));
+  setStoreTriangleMismatch(reader->readValue("StoreTriangleMismatch", getStoreTriangleMismatch()));
+  setComputeStatistics(reader->readValue("ComputeStatistics", getComputeStatistics()));
+  setSurfaceMeshFaceAreasArrayPath(reader->readDataArrayPath("SurfaceMeshFaceAreasArrayPath", getSurfaceMeshFaceAreasArrayPath()));
+  setNumberOfBins(reader->readValue("NumberOfBins", getNumberOfBins()));
+  setMismatchStatisticsAttributeMatrixName(reader->readString("MismatchStatisticsAttributeMatrixName", getMismatchStatisticsAttributeMatrixName()));
+  setMismatchHistogramArrayName(reader->readString("MismatchHistogramArrayName", getMismatchHistogramArrayName()));
+  setMismatchHistogramBoundsArrayName(reader->readString("MismatchHistogramBoundsArrayName", getMismatchHistogramBoundsArrayName()));
+  setMismatchMeanArrayName(reader->readString("MismatchMeanArrayName", getMismatchMeanArrayName()));
+  setMismatchVarianceArrayName(reader->readString("MismatchVarianceArrayName", getMismatchVarianceArrayName()));
+  setMismatchPercentilesArrayName(reader->readString("MismatchPercentilesArrayName", getMismatchPercentilesArrayName()));
+  setStreamFromFile(reader->readValue("StreamFromFile", getStreamFromFile()));
+  setStreamingInputFile(reader->readString("StreamingInputFile", getStreamingInputFile()));
+  setStreamingFaceLabelsDatasetPath(reader->readString("StreamingFaceLabelsDatasetPath", getStreamingFaceLabelsDatasetPath()));
+  setStreamingOutputFile(reader->readString("StreamingOutputFile", getStreamingOutputFile()));
+  setStreamingDeltaModulusDatasetPath(reader->readString("StreamingDeltaModulusDatasetPath", getStreamingDeltaModulusDatasetPath()));
+  setStreamingChunkSize(reader->readValue("StreamingChunkSize", getStreamingChunkSize()));
   reader->closeFilterGroup();
 }
 
@@ -135,11 +940,54 @@ void FindModulusMismatch::readFilterParameters(AbstractFilterParametersReader* r
 void FindModulusMismatch::dataCheckVoxel()
 {
   std::vector<size_t> dims(1, 1);
-  m_ModuliPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getModuliArrayPath(), dims);
-  if(nullptr != m_ModuliPtr.lock())
+  if(0 == getMismatchMode())
   {
-    m_Moduli = m_ModuliPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    // the moduli are read in their own type, execute dispatches on it
+    IDataArray::Pointer moduliPtr = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getModuliArrayPath());
+    m_ModuliPtr = moduliPtr;
+    if(nullptr != moduliPtr.get() && moduliPtr->getTypeAsString() == SIMPL::TypeNames::Bool)
+    {
+      setErrorCondition(-4, "The Moduli array must be a numeric array");
+    }
+    return;
+  }
+
+  // face normal mode evaluates the moduli from the average orientations and compliances
+  m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeaturePhasesArrayPath(), dims);
+  if(nullptr != m_FeaturePhasesPtr.lock())
+  {
+    m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0);
+  }
+
+  m_CrystalStructuresPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>>(this, getCrystalStructuresArrayPath(), dims);
+  if(nullptr != m_CrystalStructuresPtr.lock())
+  {
+    m_CrystalStructures = m_CrystalStructuresPtr.lock()->getPointer(0);
+  }
+
+  dims[0] = 4;
+  m_AvgQuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getAvgQuatsArrayPath(), dims);
+  if(nullptr != m_AvgQuatsPtr.lock())
+  {
+    m_AvgQuats = m_AvgQuatsPtr.lock()->getPointer(0);
+  }
+
+  std::vector<size_t> complianceDims(2, 6);
+  m_CrystalCompliancesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getCrystalCompliancesArrayPath(), complianceDims);
+  if(nullptr != m_CrystalCompliancesPtr.lock())
+  {
+    m_CrystalCompliances = m_CrystalCompliancesPtr.lock()->getPointer(0);
+  }
+
+  if(!getFeaturePhasesArrayPath().hasSameAttributeMatrixPath(getAvgQuatsArrayPath()))
+  {
+    setErrorCondition(-2, "Feature Phases and Average Quats must belong to the same DataContainer / AtributreMatrix");
+  }
+
+  if(!getCrystalStructuresArrayPath().hasSameAttributeMatrixPath(getCrystalCompliancesArrayPath()))
+  {
+    setErrorCondition(-2, "Crystal Structures and Crystal Compliances must belong to the same DataContainer / AtributreMatrix");
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -156,30 +1004,352 @@ void FindModulusMismatch::dataCheckSurfaceMesh()
   }
 
   std::vector<size_t> dims(1, 2);
-  m_SurfaceMeshFaceLabelsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getSurfaceMeshFaceLabelsArrayPath(), dims);
-  if(nullptr != m_SurfaceMeshFaceLabelsPtr.lock())
+  // precomputed moduli accept 32 or 64 bit labels, the face normal and feature pair paths work on 32 bit labels
+  IDataArray::Pointer labelsPtr = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getSurfaceMeshFaceLabelsArrayPath());
+  m_SurfaceMeshFaceLabelsPtr = labelsPtr;
+  m_SurfaceMeshFaceLabels = nullptr;
+  if(nullptr == labelsPtr.get())
   {
-    m_SurfaceMeshFaceLabels = m_SurfaceMeshFaceLabelsPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    return;
+  }
+  if(labelsPtr->getNumberOfComponents() != 2)
+  {
+    QString ss = QObject::tr("SurfaceMeshFaceLabels must have 2 components but has %1").arg(labelsPtr->getNumberOfComponents());
+    setErrorCondition(-4, ss);
+    return;
+  }
+  Int32ArrayType::Pointer int32Labels = std::dynamic_pointer_cast<Int32ArrayType>(labelsPtr);
+  if(nullptr != int32Labels.get())
+  {
+    m_SurfaceMeshFaceLabels = int32Labels->getPointer(0);
+  }
+  else if(nullptr == std::dynamic_pointer_cast<Int64ArrayType>(labelsPtr).get() || 0 != getMismatchMode() || getDeduplicatePairs())
+  {
+    QString ss = QObject::tr("SurfaceMeshFaceLabels of type %1 are not supported (int32_t, or int64_t with precomputed moduli per triangle)").arg(labelsPtr->getTypeAsString());
+    setErrorCondition(-4, ss);
+    return;
+  }
+
+  if(1 == getMismatchMode())
+  {
+    dims[0] = 3;
+    m_SurfaceMeshFaceNormalsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<double>>(this, getSurfaceMeshFaceNormalsArrayPath(), dims);
+    if(nullptr != m_SurfaceMeshFaceNormalsPtr.lock())
+    {
+      m_SurfaceMeshFaceNormals = m_SurfaceMeshFaceNormalsPtr.lock()->getPointer(0);
+    }
+
+    if(!getSurfaceMeshFaceNormalsArrayPath().hasSameAttributeMatrixPath(getSurfaceMeshFaceLabelsArrayPath()))
+    {
+      setErrorCondition(-2, "SurfaceMeshFaceLabels and SurfaceMeshFaceNormals must belong to the same DataContainer / AtributreMatrix");
+    }
+  }
+
+  // the delta has the component layout of the moduli (one component per property / loading direction)
   dims[0] = 1;
+  std::vector<size_t> deltaDims(1, 1);
+  IDataArray::Pointer moduliPtr = m_ModuliPtr.lock();
+  if(0 == getMismatchMode() && nullptr != moduliPtr.get())
+  {
+    deltaDims = moduliPtr->getComponentDimensions();
+  }
+
+  if(!getStoreTriangleMismatch() && !getComputeStatistics() && !getDeduplicatePairs())
+  {
+    setErrorCondition(-6, "Nothing to compute: store the mismatch per triangle, compute it once per feature pair and / or compute its statistics");
+    return;
+  }
+
+  m_SurfaceMeshFaceAreas = nullptr;
+  if(getComputeStatistics())
+  {
+    if(getNumberOfBins() < 1)
+    {
+      setErrorCondition(-7, "The number of histogram bins must be at least 1");
+      return;
+    }
+
+    m_SurfaceMeshFaceAreasPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<double>>(this, getSurfaceMeshFaceAreasArrayPath(), dims);
+    if(nullptr != m_SurfaceMeshFaceAreasPtr.lock())
+    {
+      m_SurfaceMeshFaceAreas = m_SurfaceMeshFaceAreasPtr.lock()->getPointer(0);
+    }
+    if(!getSurfaceMeshFaceAreasArrayPath().hasSameAttributeMatrixPath(getSurfaceMeshFaceLabelsArrayPath()))
+    {
+      setErrorCondition(-2, "SurfaceMeshFaceLabels and SurfaceMeshFaceAreas must belong to the same DataContainer / AtributreMatrix");
+    }
+
+    // one tuple per component of the mismatch
+    size_t numComponents = std::accumulate(deltaDims.begin(), deltaDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+    std::vector<size_t> tDims(1, numComponents);
+    AttributeMatrix::Pointer statisticsAttrMat = sm->createNonPrereqAttributeMatrix(this, getMismatchStatisticsAttributeMatrixName(), tDims, AttributeMatrix::Type::FaceEnsemble, AttributeMatrixID22);
+    if(getErrorCode() < 0 || nullptr == statisticsAttrMat.get())
+    {
+      return;
+    }
+
+    std::vector<size_t> statisticsDims(1, static_cast<size_t>(getNumberOfBins()));
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getMismatchStatisticsAttributeMatrixName(), getMismatchHistogramArrayName());
+    m_MismatchHistogramPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, statisticsDims, "", DataArrayID35);
+    if(nullptr != m_MismatchHistogramPtr.lock())
+    {
+      m_MismatchHistogram = m_MismatchHistogramPtr.lock()->getPointer(0);
+    }
+
+    statisticsDims[0] = 2;
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getMismatchStatisticsAttributeMatrixName(), getMismatchHistogramBoundsArrayName());
+    m_MismatchHistogramBoundsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, statisticsDims, "", DataArrayID36);
+    if(nullptr != m_MismatchHistogramBoundsPtr.lock())
+    {
+      m_MismatchHistogramBounds = m_MismatchHistogramBoundsPtr.lock()->getPointer(0);
+    }
+
+    statisticsDims[0] = 1;
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getMismatchStatisticsAttributeMatrixName(), getMismatchMeanArrayName());
+    m_MismatchMeanPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, statisticsDims, "", DataArrayID37);
+    if(nullptr != m_MismatchMeanPtr.lock())
+    {
+      m_MismatchMean = m_MismatchMeanPtr.lock()->getPointer(0);
+    }
+
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getMismatchStatisticsAttributeMatrixName(), getMismatchVarianceArrayName());
+    m_MismatchVariancePtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, statisticsDims, "", DataArrayID38);
+    if(nullptr != m_MismatchVariancePtr.lock())
+    {
+      m_MismatchVariance = m_MismatchVariancePtr.lock()->getPointer(0);
+    }
+
+    statisticsDims[0] = k_Percentiles.size();
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getMismatchStatisticsAttributeMatrixName(), getMismatchPercentilesArrayName());
+    m_MismatchPercentilesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, statisticsDims, "", DataArrayID39);
+    if(nullptr != m_MismatchPercentilesPtr.lock())
+    {
+      m_MismatchPercentiles = m_MismatchPercentilesPtr.lock()->getPointer(0);
+    }
+  }
+
+  if(getDeduplicatePairs())
+  {
+    if(0 != getMismatchMode())
+    {
+      setErrorCondition(-3, "Computing once per feature pair requires precomputed moduli (face normal moduli differ between the triangles of a pair)");
+      return;
+    }
+
+    // the number of unique pairs is only known after execution, the face feature arrays are resized then
+    std::vector<size_t> tDims(1, 0);
+    AttributeMatrix::Pointer faceFeatureAttrMat = sm->createNonPrereqAttributeMatrix(this, getFaceFeatureAttributeMatrixName(), tDims, AttributeMatrix::Type::FaceFeature, AttributeMatrixID21);
+    if(getErrorCode() < 0 || nullptr == faceFeatureAttrMat.get())
+    {
+      return;
+    }
+
+    dims[0] = 2;
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getFaceFeatureAttributeMatrixName(), getFeatureFaceLabelsArrayName());
+    m_FeatureFaceLabelsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID32);
+    if(nullptr != m_FeatureFaceLabelsPtr.lock())
+    {
+      m_FeatureFaceLabels = m_FeatureFaceLabelsPtr.lock()->getPointer(0);
+    }
+
+    dims[0] = 1;
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), getFaceFeatureAttributeMatrixName(), getFeatureFaceDeltaModulusArrayName());
+    m_FeatureFaceDeltaModulusPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0, deltaDims, "", DataArrayID33);
+    if(nullptr != m_FeatureFaceDeltaModulusPtr.lock())
+    {
+      m_FeatureFaceDeltaModulus = m_FeatureFaceDeltaModulusPtr.lock()->getPointer(0);
+    }
+
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), m_SurfaceMeshFaceLabelsArrayPath.getAttributeMatrixName(), getSurfaceMeshFeatureFaceIdsArrayName());
+    m_SurfaceMeshFeatureFaceIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID34);
+    if(nullptr != m_SurfaceMeshFeatureFaceIdsPtr.lock())
+    {
+      m_SurfaceMeshFeatureFaceIds = m_SurfaceMeshFeatureFaceIdsPtr.lock()->getPointer(0);
+    }
+    return;
+  }
+
+  // the per triangle mismatch is optional when only its distribution is needed
+  m_SurfaceMeshDeltaModulus = nullptr;
+  if(!getStoreTriangleMismatch())
+  {
+    return;
+  }
+
   tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), m_SurfaceMeshFaceLabelsArrayPath.getAttributeMatrixName(), getSurfaceMeshDeltaModulusArrayName());
-  m_SurfaceMeshDeltaModulusPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 180.0, dims, "", DataArrayID31);
+  m_SurfaceMeshDeltaModulusPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 180.0, deltaDims, "", DataArrayID31);
   if(nullptr != m_SurfaceMeshDeltaModulusPtr.lock())
   {
-    m_SurfaceMeshDeltaModulus = m_SurfaceMeshDeltaModulusPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void FindModulusMismatch::dataCheck()
-{
-  clearErrorCode();
-  clearWarningCode();
+    m_SurfaceMeshDeltaModulus = m_SurfaceMeshDeltaModulusPtr.lock()->getPointer(0);
+  } /* Now assign the raw pointer to data from the DataArray<T> object */
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::dataCheckStreaming(int64_t& numTriangles, size_t& labelSize)
+{
+  numTriangles = 0;
+  labelSize = 0;
+  if(0 != getMismatchMode() || getDeduplicatePairs() || getComputeStatistics())
+  {
+    setErrorCondition(-10, "Streaming through files is only available for the per triangle mismatch of precomputed moduli (without statistics)");
+    return;
+  }
+  if(getStreamingChunkSize() < 1)
+  {
+    setErrorCondition(-10, "The number of triangles per chunk must be at least 1");
+    return;
+  }
+
+  QFileInfo inputInfo(getStreamingInputFile());
+  if(getStreamingInputFile().isEmpty() || !inputInfo.exists())
+  {
+    QString ss = QObject::tr("The face labels file '%1' does not exist").arg(getStreamingInputFile());
+    setErrorCondition(-11, ss);
+    return;
+  }
+  if(getStreamingOutputFile().isEmpty() || getStreamingDeltaModulusDatasetPath().isEmpty())
+  {
+    setErrorCondition(-11, "The delta modulus file and dataset must be set");
+    return;
+  }
+  if(QFileInfo(getStreamingOutputFile()).absoluteFilePath() == inputInfo.absoluteFilePath())
+  {
+    setErrorCondition(-11, "The delta modulus file must differ from the face labels file (it is overwritten)");
+    return;
+  }
+
+  // only the metadata of the face labels is read here
+  ScopedH5Id file(H5Support::H5Utilities::openFile(getStreamingInputFile().toStdString(), true), H5Fclose);
+  if(file.get() < 0)
+  {
+    QString ss = QObject::tr("Error opening the face labels file '%1'").arg(getStreamingInputFile());
+    setErrorCondition(-12, ss);
+    return;
+  }
+  ScopedH5Id labels(H5Dopen(file.get(), getStreamingFaceLabelsDatasetPath().toStdString().c_str(), H5P_DEFAULT), H5Dclose);
+  if(labels.get() < 0)
+  {
+    QString ss = QObject::tr("Error opening the face labels dataset '%1' in '%2'").arg(getStreamingFaceLabelsDatasetPath(), getStreamingInputFile());
+    setErrorCondition(-12, ss);
+    return;
+  }
+
+  ScopedH5Id space(H5Dget_space(labels.get()), H5Sclose);
+  ScopedH5Id type(H5Dget_type(labels.get()), H5Tclose);
+  hsize_t dims[2] = {0, 0};
+  if(H5Sget_simple_extent_ndims(space.get()) != 2 || H5Sget_simple_extent_dims(space.get(), dims, nullptr) < 0 || dims[1] != 2)
+  {
+    QString ss = QObject::tr("The face labels dataset '%1' must have N x 2 values").arg(getStreamingFaceLabelsDatasetPath());
+    setErrorCondition(-4, ss);
+    return;
+  }
+  size_t size = H5Tget_size(type.get());
+  if(H5Tget_class(type.get()) != H5T_INTEGER || H5Tget_sign(type.get()) != H5T_SGN_2 || (size != 4 && size != 8))
+  {
+    QString ss = QObject::tr("The face labels dataset '%1' must hold 32 or 64 bit signed integers").arg(getStreamingFaceLabelsDatasetPath());
+    setErrorCondition(-4, ss);
+    return;
+  }
+  numTriangles = static_cast<int64_t>(dims[0]);
+  labelSize = size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+
+  dataCheckVoxel();
+  if(getStreamFromFile())
+  {
+    int64_t numTriangles = 0;
+    size_t labelSize = 0;
+    dataCheckStreaming(numTriangles, labelSize);
+    return;
+  }
+  dataCheckSurfaceMesh();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::executeStreaming()
+{
+  int64_t numTriangles = 0;
+  size_t labelSize = 0;
+  dataCheckStreaming(numTriangles, labelSize);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  QFileInfo outputInfo(getStreamingOutputFile());
+  QDir parentPath(outputInfo.path());
+  if(!parentPath.mkpath("."))
+  {
+    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
+    setErrorCondition(-13, ss);
+    return;
+  }
+  ScopedH5Id outputFile(H5Support::H5Utilities::createFile(getStreamingOutputFile().toStdString()), H5Fclose);
+  ScopedH5Id inputFile(H5Support::H5Utilities::openFile(getStreamingInputFile().toStdString(), true), H5Fclose);
+  if(outputFile.get() < 0 || inputFile.get() < 0)
+  {
+    QString ss = QObject::tr("Error creating the delta modulus file '%1'").arg(getStreamingOutputFile());
+    setErrorCondition(-13, ss);
+    return;
+  }
+
+  // the delta is stored as N x (number of components of the moduli), creating the groups along its path
+  IDataArray::Pointer moduliPtr = m_ModuliPtr.lock();
+  hsize_t deltaDims[2] = {static_cast<hsize_t>(numTriangles), static_cast<hsize_t>(moduliPtr->getNumberOfComponents())};
+  ScopedH5Id deltaSpace(H5Screate_simple(2, deltaDims, nullptr), H5Sclose);
+  ScopedH5Id linkProperties(H5Pcreate(H5P_LINK_CREATE), H5Pclose);
+  H5Pset_create_intermediate_group(linkProperties.get(), 1);
+  ScopedH5Id labels(H5Dopen(inputFile.get(), getStreamingFaceLabelsDatasetPath().toStdString().c_str(), H5P_DEFAULT), H5Dclose);
+  ScopedH5Id delta(H5Dcreate2(outputFile.get(), getStreamingDeltaModulusDatasetPath().toStdString().c_str(), H5T_NATIVE_FLOAT, deltaSpace.get(), linkProperties.get(), H5P_DEFAULT, H5P_DEFAULT),
+                   H5Dclose);
+  if(labels.get() < 0 || delta.get() < 0)
+  {
+    QString ss = QObject::tr("Error creating the delta modulus dataset '%1' in '%2'").arg(getStreamingDeltaModulusDatasetPath(), getStreamingOutputFile());
+    setErrorCondition(-13, ss);
+    return;
+  }
+
+  // peak memory is one chunk of labels and deltas, whatever the number of triangles
+  size_t chunkSize = static_cast<size_t>(std::min(static_cast<int64_t>(getStreamingChunkSize()), std::max(numTriangles, static_cast<int64_t>(1))));
+  int err = 0;
+  if(8 == labelSize)
+  {
+    err = StreamModulusMismatch<int64_t>(this, moduliPtr, labels.get(), delta.get(), numTriangles, chunkSize);
+  }
+  else
+  {
+    err = StreamModulusMismatch<int32_t>(this, moduliPtr, labels.get(), delta.get(), numTriangles, chunkSize);
+  }
+  if(-5 == err)
+  {
+    QString ss = QObject::tr("Moduli of type %1 are not supported").arg(moduliPtr->getTypeAsString());
+    setErrorCondition(-5, ss);
+    return;
+  }
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error transferring a chunk of triangles between '%1' and '%2'").arg(getStreamingInputFile(), getStreamingOutputFile());
+    setErrorCondition(-9, ss);
+    return;
+  }
+  if(err > 0)
+  {
+    return;
+  }
 
-  dataCheckVoxel();
-  dataCheckSurfaceMesh();
+  notifyStatusMessage("Completed");
 }
 
 // -----------------------------------------------------------------------------
@@ -194,24 +1364,172 @@ void FindModulusMismatch::execute()
   {
     return;
   }
+  if(getStreamFromFile())
+  {
+    executeStreaming();
+    return;
+  }
   dataCheckSurfaceMesh();
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  int64_t numTriangles = m_SurfaceMeshFaceLabelsPtr.lock()->getNumberOfTuples();
+  IDataArray::Pointer moduliPtr = m_ModuliPtr.lock();
+  IDataArray::Pointer labelsPtr = m_SurfaceMeshFaceLabelsPtr.lock();
+  int64_t numTriangles = labelsPtr->getNumberOfTuples();
+
+  // the statistics are accumulated in the same pass that computes the mismatch
+  MismatchStatisticsOutputs statistics;
+  statistics.areas = m_SurfaceMeshFaceAreas;
+  statistics.numBins = static_cast<size_t>(getNumberOfBins());
+  statistics.histograms = m_MismatchHistogram;
+  statistics.bounds = m_MismatchHistogramBounds;
+  statistics.means = m_MismatchMean;
+  statistics.variances = m_MismatchVariance;
+  statistics.percentiles = m_MismatchPercentiles;
 
+  if(getDeduplicatePairs())
+  {
+    // collect the unique pairs of each chunk of triangles in parallel and merge them (sorted so the ids don't depend on the threading)
+    size_t numChunks = (static_cast<size_t>(numTriangles) + k_PairChunkSize - 1) / k_PairChunkSize;
+    std::vector<std::vector<uint64_t>> chunkKeys(numChunks);
+    FindFeaturePairsImpl pairsImpl(m_SurfaceMeshFaceLabels, numTriangles, chunkKeys);
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  if(true)
+    if(true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), pairsImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      pairsImpl.generate(0, numChunks);
+    }
+
+    std::vector<uint64_t> pairs;
+    for(std::vector<uint64_t>& keys : chunkKeys)
+    {
+      pairs.insert(pairs.end(), keys.begin(), keys.end());
+      std::vector<uint64_t>().swap(keys);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    // size the face feature attribute matrix (pair 0 is reserved for triangles that don't separate two features)
+    std::vector<size_t> tDims(1, pairs.size() + 1);
+    getDataContainerArray()->getAttributeMatrix(m_FeatureFaceLabelsPtr.lock()->getDataArrayPath())->resizeAttributeArrays(tDims);
+    m_FeatureFaceLabels = m_FeatureFaceLabelsPtr.lock()->getPointer(0);
+    m_FeatureFaceDeltaModulus = m_FeatureFaceDeltaModulusPtr.lock()->getPointer(0);
+    m_FeatureFaceLabels[0] = 0;
+    m_FeatureFaceLabels[1] = 0;
+    for(size_t p = 0; p < pairs.size(); p++)
+    {
+      m_FeatureFaceLabels[2 * (p + 1)] = static_cast<int32_t>(pairs[p] >> 32);
+      m_FeatureFaceLabels[2 * (p + 1) + 1] = static_cast<int32_t>(pairs[p] & 0xFFFFFFFFULL);
+    }
+
+    // index each triangle into the pairs and evaluate the mismatch once per pair
+    FindFeatureFaceIdsImpl idsImpl(m_SurfaceMeshFaceLabels, pairs, m_SurfaceMeshFeatureFaceIds);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numTriangles), idsImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      idsImpl.generate(0, numTriangles);
+    }
+    if(!DispatchModulusMismatch(moduliPtr, m_FeatureFaceLabels, m_FeatureFaceDeltaModulus, tDims[0]))
+    {
+      QString ss = QObject::tr("Moduli of type %1 are not supported").arg(moduliPtr->getTypeAsString());
+      setErrorCondition(-5, ss);
+      return;
+    }
+
+    if(getComputeStatistics())
+    {
+      // every triangle takes the mismatch of its pair, so the largest pair mismatch bounds the histograms
+      size_t numComponents = m_FeatureFaceDeltaModulusPtr.lock()->getNumberOfComponents();
+      std::vector<float> maxima(numComponents, 0.0f);
+      for(size_t j = 0; j < tDims[0] * numComponents; j++)
+      {
+        maxima[j % numComponents] = std::max(maxima[j % numComponents], m_FeatureFaceDeltaModulus[j]);
+      }
+      FeatureFaceMismatchLookup lookup(m_SurfaceMeshFeatureFaceIds, m_FeatureFaceDeltaModulus, numComponents);
+      FindMismatchStatistics(lookup, numComponents, maxima, nullptr, numTriangles, statistics);
+    }
+
+    QString ss = QObject::tr("Found %1 unique feature pairs among %2 triangles").arg(pairs.size()).arg(numTriangles);
+    notifyStatusMessage(ss);
+    notifyStatusMessage("Completed");
+    return;
+  }
+
+  if(1 == getMismatchMode())
+  {
+    // fold the compliances of each phase into s'11 coefficients and select its kernel once
+    size_t numPhases = m_CrystalStructuresPtr.lock()->getNumberOfTuples();
+    std::vector<DirectionalModulusKernels::ComplianceCoefficients> coefficients(numPhases);
+    std::vector<DirectionalModulusKernels::ElasticSymmetry> symmetries(numPhases);
+    for(size_t p = 0; p < numPhases; p++)
+    {
+      coefficients[p] = DirectionalModulusKernels::ComplianceCoefficients::FromCompliances(m_CrystalCompliances + 36 * p);
+      symmetries[p] = DirectionalModulusKernels::FindElasticSymmetry(m_CrystalStructures[p]);
+    }
+
+    FindNormalModulusMismatchImpl impl(m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_FeaturePhases, m_AvgQuats, m_CrystalStructures, coefficients, symmetries, m_SurfaceMeshDeltaModulus);
+    if(getComputeStatistics())
+    {
+      // no mismatch can exceed the spread between the stiffest and most compliant directions of the phases
+      std::vector<float> maxima(1, 0.0f);
+      std::pair<float, float> range(std::numeric_limits<float>::max(), 0.0f);
+      for(size_t p = 0; p < numPhases; p++)
+      {
+        if(m_CrystalStructures[p] < EbsdLib::CrystalStructure::LaueGroupEnd)
+        {
+          DirectionalModulusKernels::ExtremalModuli extremal = DirectionalModulusKernels::FindExtremalModuli(symmetries[p], coefficients[p]);
+          range.first = std::min(range.first, extremal.minModulus);
+          range.second = std::max(range.second, extremal.maxModulus);
+        }
+      }
+      maxima[0] = std::max(0.0f, range.second - range.first);
+      FindMismatchStatistics(impl, 1, maxima, m_SurfaceMeshDeltaModulus, numTriangles, statistics);
+      notifyStatusMessage("Completed");
+      return;
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numTriangles, k_GrainSize), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.generate(0, numTriangles);
+    }
+
+    notifyStatusMessage("Completed");
+    return;
+  }
+
+  // run the instantiation matching the actual moduli and label types (no converted copy of either array)
+  bool supported = false;
+  if(nullptr != m_SurfaceMeshFaceLabels)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTriangles), FindModulusMismatchImpl(m_SurfaceMeshFaceLabels, m_Moduli, m_SurfaceMeshDeltaModulus), tbb::auto_partitioner());
+    supported = DispatchModulusMismatch(moduliPtr, m_SurfaceMeshFaceLabels, m_SurfaceMeshDeltaModulus, numTriangles, getComputeStatistics() ? &statistics : nullptr);
   }
   else
-#endif
   {
-    FindModulusMismatchImpl serial(m_SurfaceMeshFaceLabels, m_Moduli, m_SurfaceMeshDeltaModulus);
-    serial.generate(0, numTriangles);
+    Int64ArrayType::Pointer int64Labels = std::dynamic_pointer_cast<Int64ArrayType>(labelsPtr);
+    supported = DispatchModulusMismatch(moduliPtr, int64Labels->getPointer(0), m_SurfaceMeshDeltaModulus, numTriangles, getComputeStatistics() ? &statistics : nullptr);
+  }
+  if(!supported)
+  {
+    QString ss = QObject::tr("Moduli of type %1 are not supported").arg(moduliPtr->getTypeAsString());
+    setErrorCondition(-5, ss);
+    return;
   }
 
   notifyStatusMessage("Completed");
@@ -353,3 +1671,267 @@ QString FindModulusMismatch::getSurfaceMeshDeltaModulusArrayName() const
 {
   return m_SurfaceMeshDeltaModulusArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchMode(int value)
+{
+  m_MismatchMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindModulusMismatch::getMismatchMode() const
+{
+  return m_MismatchMode;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setSurfaceMeshFaceNormalsArrayPath(const DataArrayPath& value)
+{
+  m_SurfaceMeshFaceNormalsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindModulusMismatch::getSurfaceMeshFaceNormalsArrayPath() const
+{
+  return m_SurfaceMeshFaceNormalsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setFeaturePhasesArrayPath(const DataArrayPath& value)
+{
+  m_FeaturePhasesArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindModulusMismatch::getFeaturePhasesArrayPath() const
+{
+  return m_FeaturePhasesArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setAvgQuatsArrayPath(const DataArrayPath& value)
+{
+  m_AvgQuatsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindModulusMismatch::getAvgQuatsArrayPath() const
+{
+  return m_AvgQuatsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setCrystalStructuresArrayPath(const DataArrayPath& value)
+{
+  m_CrystalStructuresArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindModulusMismatch::getCrystalStructuresArrayPath() const
+{
+  return m_CrystalStructuresArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setCrystalCompliancesArrayPath(const DataArrayPath& value)
+{
+  m_CrystalCompliancesArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindModulusMismatch::getCrystalCompliancesArrayPath() const
+{
+  return m_CrystalCompliancesArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStoreTriangleMismatch(bool value)
+{
+  m_StoreTriangleMismatch = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindModulusMismatch::getStoreTriangleMismatch() const
+{
+  return m_StoreTriangleMismatch;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setComputeStatistics(bool value)
+{
+  m_ComputeStatistics = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindModulusMismatch::getComputeStatistics() const
+{
+  return m_ComputeStatistics;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setSurfaceMeshFaceAreasArrayPath(const DataArrayPath& value)
+{
+  m_SurfaceMeshFaceAreasArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindModulusMismatch::getSurfaceMeshFaceAreasArrayPath() const
+{
+  return m_SurfaceMeshFaceAreasArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setNumberOfBins(int value)
+{
+  m_NumberOfBins = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindModulusMismatch::getNumberOfBins() const
+{
+  return m_NumberOfBins;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchStatisticsAttributeMatrixName(const QString& value)
+{
+  m_MismatchStatisticsAttributeMatrixName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getMismatchStatisticsAttributeMatrixName() const
+{
+  return m_MismatchStatisticsAttributeMatrixName;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchHistogramArrayName(const QString& value)
+{
+  m_MismatchHistogramArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getMismatchHistogramArrayName() const
+{
+  return m_MismatchHistogramArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchHistogramBoundsArrayName(const QString& value)
+{
+  m_MismatchHistogramBoundsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getMismatchHistogramBoundsArrayName() const
+{
+  return m_MismatchHistogramBoundsArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchMeanArrayName(const QString& value)
+{
+  m_MismatchMeanArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getMismatchMeanArrayName() const
+{
+  return m_MismatchMeanArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchVarianceArrayName(const QString& value)
+{
+  m_MismatchVarianceArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getMismatchVarianceArrayName() const
+{
+  return m_MismatchVarianceArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setMismatchPercentilesArrayName(const QString& value)
+{
+  m_MismatchPercentilesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getMismatchPercentilesArrayName() const
+{
+  return m_MismatchPercentilesArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStreamFromFile(bool value)
+{
+  m_StreamFromFile = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindModulusMismatch::getStreamFromFile() const
+{
+  return m_StreamFromFile;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStreamingInputFile(const QString& value)
+{
+  m_StreamingInputFile = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getStreamingInputFile() const
+{
+  return m_StreamingInputFile;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStreamingFaceLabelsDatasetPath(const QString& value)
+{
+  m_StreamingFaceLabelsDatasetPath = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getStreamingFaceLabelsDatasetPath() const
+{
+  return m_StreamingFaceLabelsDatasetPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStreamingOutputFile(const QString& value)
+{
+  m_StreamingOutputFile = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getStreamingOutputFile() const
+{
+  return m_StreamingOutputFile;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStreamingDeltaModulusDatasetPath(const QString& value)
+{
+  m_StreamingDeltaModulusDatasetPath = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindModulusMismatch::getStreamingDeltaModulusDatasetPath() const
+{
+  return m_StreamingDeltaModulusDatasetPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindModulusMismatch::setStreamingChunkSize(int value)
+{
+  m_StreamingChunkSize = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindModulusMismatch::getStreamingChunkSize() const
+{
+  return m_StreamingChunkSize;
+}
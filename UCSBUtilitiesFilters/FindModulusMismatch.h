@@ -46,6 +46,33 @@ class UCSBUtilities_EXPORT FindModulusMismatch : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath ModuliArrayPath READ getModuliArrayPath WRITE setModuliArrayPath)
   PYB11_PROPERTY(DataArrayPath SurfaceMeshFaceLabelsArrayPath READ getSurfaceMeshFaceLabelsArrayPath WRITE setSurfaceMeshFaceLabelsArrayPath)
   PYB11_PROPERTY(QString SurfaceMeshDeltaModulusArrayName READ getSurfaceMeshDeltaModulusArrayName WRITE setSurfaceMeshDeltaModulusArrayName)
+  PYB11_PROPERTY(int MismatchMode READ getMismatchMode WRITE setMismatchMode)
+  PYB11_PROPERTY(DataArrayPath SurfaceMeshFaceNormalsArrayPath READ getSurfaceMeshFaceNormalsArrayPath WRITE setSurfaceMeshFaceNormalsArrayPath)
+  PYB11_PROPERTY(DataArrayPath FeaturePhasesArrayPath READ getFeaturePhasesArrayPath WRITE setFeaturePhasesArrayPath)
+  PYB11_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
+  PYB11_PROPERTY(DataArrayPath CrystalStructuresArrayPath READ getCrystalStructuresArrayPath WRITE setCrystalStructuresArrayPath)
+  PYB11_PROPERTY(DataArrayPath CrystalCompliancesArrayPath READ getCrystalCompliancesArrayPath WRITE setCrystalCompliancesArrayPath)
+  PYB11_PROPERTY(bool DeduplicatePairs READ getDeduplicatePairs WRITE setDeduplicatePairs)
+  PYB11_PROPERTY(QString FaceFeatureAttributeMatrixName READ getFaceFeatureAttributeMatrixName WRITE setFaceFeatureAttributeMatrixName)
+  PYB11_PROPERTY(QString FeatureFaceLabelsArrayName READ getFeatureFaceLabelsArrayName WRITE setFeatureFaceLabelsArrayName)
+  PYB11_PROPERTY(QString FeatureFaceDeltaModulusArrayName READ getFeatureFaceDeltaModulusArrayName WRITE setFeatureFaceDeltaModulusArrayName)
+  PYB11_PROPERTY(QString SurfaceMeshFeatureFaceIdsArrayName READ getSurfaceMeshFeatureFaceIdsArrayName WRITE setSurfaceMeshFeatureFaceIdsArrayName)
+  PYB11_PROPERTY(bool StoreTriangleMismatch READ getStoreTriangleMismatch WRITE setStoreTriangleMismatch)
+  PYB11_PROPERTY(bool ComputeStatistics READ getComputeStatistics WRITE setComputeStatistics)
+  PYB11_PROPERTY(DataArrayPath SurfaceMeshFaceAreasArrayPath READ getSurfaceMeshFaceAreasArrayPath WRITE setSurfaceMeshFaceAreasArrayPath)
+  PYB11_PROPERTY(int NumberOfBins READ getNumberOfBins WRITE setNumberOfBins)
+  PYB11_PROPERTY(QString MismatchStatisticsAttributeMatrixName READ getMismatchStatisticsAttributeMatrixName WRITE setMismatchStatisticsAttributeMatrixName)
+  PYB11_PROPERTY(QString MismatchHistogramArrayName READ getMismatchHistogramArrayName WRITE setMismatchHistogramArrayName)
+  PYB11_PROPERTY(QString MismatchHistogramBoundsArrayName READ getMismatchHistogramBoundsArrayName WRITE setMismatchHistogramBoundsArrayName)
+  PYB11_PROPERTY(QString MismatchMeanArrayName READ getMismatchMeanArrayName WRITE setMismatchMeanArrayName)
+  PYB11_PROPERTY(QString MismatchVarianceArrayName READ getMismatchVarianceArrayName WRITE setMismatchVarianceArrayName)
+  PYB11_PROPERTY(QString MismatchPercentilesArrayName READ getMismatchPercentilesArrayName WRITE setMismatchPercentilesArrayName)
+  PYB11_PROPERTY(bool StreamFromFile READ getStreamFromFile WRITE setStreamFromFile)
+  PYB11_PROPERTY(QString StreamingInputFile READ getStreamingInputFile WRITE setStreamingInputFile)
+  PYB11_PROPERTY(QString StreamingFaceLabelsDatasetPath READ getStreamingFaceLabelsDatasetPath WRITE setStreamingFaceLabelsDatasetPath)
+  PYB11_PROPERTY(QString StreamingOutputFile READ getStreamingOutputFile WRITE setStreamingOutputFile)
+  PYB11_PROPERTY(QString StreamingDeltaModulusDatasetPath READ getStreamingDeltaModulusDatasetPath WRITE setStreamingDeltaModulusDatasetPath)
+  PYB11_PROPERTY(int StreamingChunkSize READ getStreamingChunkSize WRITE setStreamingChunkSize)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -106,6 +133,330 @@ public:
 
   Q_PROPERTY(QString SurfaceMeshDeltaModulusArrayName READ getSurfaceMeshDeltaModulusArrayName WRITE setSurfaceMeshDeltaModulusArrayName)
 
+  /**
+   * @brief Setter property for MismatchMode
+   */
+  void setMismatchMode(int value);
+  /**
+   * @brief Getter property for MismatchMode
+   * @return Value of MismatchMode
+   */
+  int getMismatchMode() const;
+
+  Q_PROPERTY(int MismatchMode READ getMismatchMode WRITE setMismatchMode)
+
+  /**
+   * @brief Setter property for SurfaceMeshFaceNormalsArrayPath
+   */
+  void setSurfaceMeshFaceNormalsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for SurfaceMeshFaceNormalsArrayPath
+   * @return Value of SurfaceMeshFaceNormalsArrayPath
+   */
+  DataArrayPath getSurfaceMeshFaceNormalsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath SurfaceMeshFaceNormalsArrayPath READ getSurfaceMeshFaceNormalsArrayPath WRITE setSurfaceMeshFaceNormalsArrayPath)
+
+  /**
+   * @brief Setter property for FeaturePhasesArrayPath
+   */
+  void setFeaturePhasesArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeaturePhasesArrayPath
+   * @return Value of FeaturePhasesArrayPath
+   */
+  DataArrayPath getFeaturePhasesArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath FeaturePhasesArrayPath READ getFeaturePhasesArrayPath WRITE setFeaturePhasesArrayPath)
+
+  /**
+   * @brief Setter property for AvgQuatsArrayPath
+   */
+  void setAvgQuatsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for AvgQuatsArrayPath
+   * @return Value of AvgQuatsArrayPath
+   */
+  DataArrayPath getAvgQuatsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
+
+  /**
+   * @brief Setter property for CrystalStructuresArrayPath
+   */
+  void setCrystalStructuresArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for CrystalStructuresArrayPath
+   * @return Value of CrystalStructuresArrayPath
+   */
+  DataArrayPath getCrystalStructuresArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath CrystalStructuresArrayPath READ getCrystalStructuresArrayPath WRITE setCrystalStructuresArrayPath)
+
+  /**
+   * @brief Setter property for CrystalCompliancesArrayPath
+   */
+  void setCrystalCompliancesArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for CrystalCompliancesArrayPath
+   * @return Value of CrystalCompliancesArrayPath
+   */
+  DataArrayPath getCrystalCompliancesArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath CrystalCompliancesArrayPath READ getCrystalCompliancesArrayPath WRITE setCrystalCompliancesArrayPath)
+
+  /**
+   * @brief Setter property for DeduplicatePairs
+   */
+  void setDeduplicatePairs(bool value);
+  /**
+   * @brief Getter property for DeduplicatePairs
+   * @return Value of DeduplicatePairs
+   */
+  bool getDeduplicatePairs() const;
+
+  Q_PROPERTY(bool DeduplicatePairs READ getDeduplicatePairs WRITE setDeduplicatePairs)
+
+  /**
+   * @brief Setter property for FaceFeatureAttributeMatrixName
+   */
+  void setFaceFeatureAttributeMatrixName(const QString& value);
+  /**
+   * @brief Getter property for FaceFeatureAttributeMatrixName
+   * @return Value of FaceFeatureAttributeMatrixName
+   */
+  QString getFaceFeatureAttributeMatrixName() const;
+
+  Q_PROPERTY(QString FaceFeatureAttributeMatrixName READ getFaceFeatureAttributeMatrixName WRITE setFaceFeatureAttributeMatrixName)
+
+  /**
+   * @brief Setter property for FeatureFaceLabelsArrayName
+   */
+  void setFeatureFaceLabelsArrayName(const QString& value);
+  /**
+   * @brief Getter property for FeatureFaceLabelsArrayName
+   * @return Value of FeatureFaceLabelsArrayName
+   */
+  QString getFeatureFaceLabelsArrayName() const;
+
+  Q_PROPERTY(QString FeatureFaceLabelsArrayName READ getFeatureFaceLabelsArrayName WRITE setFeatureFaceLabelsArrayName)
+
+  /**
+   * @brief Setter property for FeatureFaceDeltaModulusArrayName
+   */
+  void setFeatureFaceDeltaModulusArrayName(const QString& value);
+  /**
+   * @brief Getter property for FeatureFaceDeltaModulusArrayName
+   * @return Value of FeatureFaceDeltaModulusArrayName
+   */
+  QString getFeatureFaceDeltaModulusArrayName() const;
+
+  Q_PROPERTY(QString FeatureFaceDeltaModulusArrayName READ getFeatureFaceDeltaModulusArrayName WRITE setFeatureFaceDeltaModulusArrayName)
+
+  /**
+   * @brief Setter property for SurfaceMeshFeatureFaceIdsArrayName
+   */
+  void setSurfaceMeshFeatureFaceIdsArrayName(const QString& value);
+  /**
+   * @brief Getter property for SurfaceMeshFeatureFaceIdsArrayName
+   * @return Value of SurfaceMeshFeatureFaceIdsArrayName
+   */
+  QString getSurfaceMeshFeatureFaceIdsArrayName() const;
+
+  Q_PROPERTY(QString SurfaceMeshFeatureFaceIdsArrayName READ getSurfaceMeshFeatureFaceIdsArrayName WRITE setSurfaceMeshFeatureFaceIdsArrayName)
+
+  /**
+   * @brief Setter property for StoreTriangleMismatch
+   */
+  void setStoreTriangleMismatch(bool value);
+  /**
+   * @brief Getter property for StoreTriangleMismatch
+   * @return Value of StoreTriangleMismatch
+   */
+  bool getStoreTriangleMismatch() const;
+
+  Q_PROPERTY(bool StoreTriangleMismatch READ getStoreTriangleMismatch WRITE setStoreTriangleMismatch)
+
+  /**
+   * @brief Setter property for ComputeStatistics
+   */
+  void setComputeStatistics(bool value);
+  /**
+   * @brief Getter property for ComputeStatistics
+   * @return Value of ComputeStatistics
+   */
+  bool getComputeStatistics() const;
+
+  Q_PROPERTY(bool ComputeStatistics READ getComputeStatistics WRITE setComputeStatistics)
+
+  /**
+   * @brief Setter property for SurfaceMeshFaceAreasArrayPath
+   */
+  void setSurfaceMeshFaceAreasArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for SurfaceMeshFaceAreasArrayPath
+   * @return Value of SurfaceMeshFaceAreasArrayPath
+   */
+  DataArrayPath getSurfaceMeshFaceAreasArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath SurfaceMeshFaceAreasArrayPath READ getSurfaceMeshFaceAreasArrayPath WRITE setSurfaceMeshFaceAreasArrayPath)
+
+  /**
+   * @brief Setter property for NumberOfBins
+   */
+  void setNumberOfBins(int value);
+  /**
+   * @brief Getter property for NumberOfBins
+   * @return Value of NumberOfBins
+   */
+  int getNumberOfBins() const;
+
+  Q_PROPERTY(int NumberOfBins READ getNumberOfBins WRITE setNumberOfBins)
+
+  /**
+   * @brief Setter property for MismatchStatisticsAttributeMatrixName
+   */
+  void setMismatchStatisticsAttributeMatrixName(const QString& value);
+  /**
+   * @brief Getter property for MismatchStatisticsAttributeMatrixName
+   * @return Value of MismatchStatisticsAttributeMatrixName
+   */
+  QString getMismatchStatisticsAttributeMatrixName() const;
+
+  Q_PROPERTY(QString MismatchStatisticsAttributeMatrixName READ getMismatchStatisticsAttributeMatrixName WRITE setMismatchStatisticsAttributeMatrixName)
+
+  /**
+   * @brief Setter property for MismatchHistogramArrayName
+   */
+  void setMismatchHistogramArrayName(const QString& value);
+  /**
+   * @brief Getter property for MismatchHistogramArrayName
+   * @return Value of MismatchHistogramArrayName
+   */
+  QString getMismatchHistogramArrayName() const;
+
+  Q_PROPERTY(QString MismatchHistogramArrayName READ getMismatchHistogramArrayName WRITE setMismatchHistogramArrayName)
+
+  /**
+   * @brief Setter property for MismatchHistogramBoundsArrayName
+   */
+  void setMismatchHistogramBoundsArrayName(const QString& value);
+  /**
+   * @brief Getter property for MismatchHistogramBoundsArrayName
+   * @return Value of MismatchHistogramBoundsArrayName
+   */
+  QString getMismatchHistogramBoundsArrayName() const;
+
+  Q_PROPERTY(QString MismatchHistogramBoundsArrayName READ getMismatchHistogramBoundsArrayName WRITE setMismatchHistogramBoundsArrayName)
+
+  /**
+   * @brief Setter property for MismatchMeanArrayName
+   */
+  void setMismatchMeanArrayName(const QString& value);
+  /**
+   * @brief Getter property for MismatchMeanArrayName
+   * @return Value of MismatchMeanArrayName
+   */
+  QString getMismatchMeanArrayName() const;
+
+  Q_PROPERTY(QString MismatchMeanArrayName READ getMismatchMeanArrayName WRITE setMismatchMeanArrayName)
+
+  /**
+   * @brief Setter property for MismatchVarianceArrayName
+   */
+  void setMismatchVarianceArrayName(const QString& value);
+  /**
+   * @brief Getter property for MismatchVarianceArrayName
+   * @return Value of MismatchVarianceArrayName
+   */
+  QString getMismatchVarianceArrayName() const;
+
+  Q_PROPERTY(QString MismatchVarianceArrayName READ getMismatchVarianceArrayName WRITE setMismatchVarianceArrayName)
+
+  /**
+   * @brief Setter property for MismatchPercentilesArrayName
+   */
+  void setMismatchPercentilesArrayName(const QString& value);
+  /**
+   * @brief Getter property for MismatchPercentilesArrayName
+   * @return Value of MismatchPercentilesArrayName
+   */
+  QString getMismatchPercentilesArrayName() const;
+
+  Q_PROPERTY(QString MismatchPercentilesArrayName READ getMismatchPercentilesArrayName WRITE setMismatchPercentilesArrayName)
+
+  /**
+   * @brief Setter property for StreamFromFile
+   */
+  void setStreamFromFile(bool value);
+  /**
+   * @brief Getter property for StreamFromFile
+   * @return Value of StreamFromFile
+   */
+  bool getStreamFromFile() const;
+
+  Q_PROPERTY(bool StreamFromFile READ getStreamFromFile WRITE setStreamFromFile)
+
+  /**
+   * @brief Setter property for StreamingInputFile
+   */
+  void setStreamingInputFile(const QString& value);
+  /**
+   * @brief Getter property for StreamingInputFile
+   * @return Value of StreamingInputFile
+   */
+  QString getStreamingInputFile() const;
+
+  Q_PROPERTY(QString StreamingInputFile READ getStreamingInputFile WRITE setStreamingInputFile)
+
+  /**
+   * @brief Setter property for StreamingFaceLabelsDatasetPath
+   */
+  void setStreamingFaceLabelsDatasetPath(const QString& value);
+  /**
+   * @brief Getter property for StreamingFaceLabelsDatasetPath
+   * @return Value of StreamingFaceLabelsDatasetPath
+   */
+  QString getStreamingFaceLabelsDatasetPath() const;
+
+  Q_PROPERTY(QString StreamingFaceLabelsDatasetPath READ getStreamingFaceLabelsDatasetPath WRITE setStreamingFaceLabelsDatasetPath)
+
+  /**
+   * @brief Setter property for StreamingOutputFile
+   */
+  void setStreamingOutputFile(const QString& value);
+  /**
+   * @brief Getter property for StreamingOutputFile
+   * @return Value of StreamingOutputFile
+   */
+  QString getStreamingOutputFile() const;
+
+  Q_PROPERTY(QString StreamingOutputFile READ getStreamingOutputFile WRITE setStreamingOutputFile)
+
+  /**
+   * @brief Setter property for StreamingDeltaModulusDatasetPath
+   */
+  void setStreamingDeltaModulusDatasetPath(const QString& value);
+  /**
+   * @brief Getter property for StreamingDeltaModulusDatasetPath
+   * @return Value of StreamingDeltaModulusDatasetPath
+   */
+  QString getStreamingDeltaModulusDatasetPath() const;
+
+  Q_PROPERTY(QString StreamingDeltaModulusDatasetPath READ getStreamingDeltaModulusDatasetPath WRITE setStreamingDeltaModulusDatasetPath)
+
+  /**
+   * @brief Setter property for StreamingChunkSize
+   */
+  void setStreamingChunkSize(int value);
+  /**
+   * @brief Getter property for StreamingChunkSize
+   * @return Value of StreamingChunkSize
+   */
+  int getStreamingChunkSize() const;
+
+  Q_PROPERTY(int StreamingChunkSize READ getStreamingChunkSize WRITE setStreamingChunkSize)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -175,16 +526,70 @@ protected:
   void dataCheck() override;
 
 private:
-  std::weak_ptr<DataArray<float>> m_ModuliPtr;
-  float* m_Moduli = nullptr;
-  std::weak_ptr<DataArray<int32_t>> m_SurfaceMeshFaceLabelsPtr;
+  std::weak_ptr<IDataArray> m_ModuliPtr;
+  std::weak_ptr<IDataArray> m_SurfaceMeshFaceLabelsPtr;
   int32_t* m_SurfaceMeshFaceLabels = nullptr;
   std::weak_ptr<DataArray<float>> m_SurfaceMeshDeltaModulusPtr;
   float* m_SurfaceMeshDeltaModulus = nullptr;
+  std::weak_ptr<DataArray<double>> m_SurfaceMeshFaceNormalsPtr;
+  double* m_SurfaceMeshFaceNormals = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeaturePhasesPtr;
+  int32_t* m_FeaturePhases = nullptr;
+  std::weak_ptr<DataArray<float>> m_AvgQuatsPtr;
+  float* m_AvgQuats = nullptr;
+  std::weak_ptr<DataArray<unsigned int>> m_CrystalStructuresPtr;
+  unsigned int* m_CrystalStructures = nullptr;
+  std::weak_ptr<DataArray<float>> m_CrystalCompliancesPtr;
+  float* m_CrystalCompliances = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeatureFaceLabelsPtr;
+  int32_t* m_FeatureFaceLabels = nullptr;
+  std::weak_ptr<DataArray<float>> m_FeatureFaceDeltaModulusPtr;
+  float* m_FeatureFaceDeltaModulus = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_SurfaceMeshFeatureFaceIdsPtr;
+  int32_t* m_SurfaceMeshFeatureFaceIds = nullptr;
+  std::weak_ptr<DataArray<double>> m_SurfaceMeshFaceAreasPtr;
+  double* m_SurfaceMeshFaceAreas = nullptr;
+  std::weak_ptr<DataArray<float>> m_MismatchHistogramPtr;
+  float* m_MismatchHistogram = nullptr;
+  std::weak_ptr<DataArray<float>> m_MismatchHistogramBoundsPtr;
+  float* m_MismatchHistogramBounds = nullptr;
+  std::weak_ptr<DataArray<float>> m_MismatchMeanPtr;
+  float* m_MismatchMean = nullptr;
+  std::weak_ptr<DataArray<float>> m_MismatchVariancePtr;
+  float* m_MismatchVariance = nullptr;
+  std::weak_ptr<DataArray<float>> m_MismatchPercentilesPtr;
+  float* m_MismatchPercentiles = nullptr;
 
   DataArrayPath m_ModuliArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, "ElasticModuli"};
   DataArrayPath m_SurfaceMeshFaceLabelsArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceLabels};
   QString m_SurfaceMeshDeltaModulusArrayName = {"SurfaceMeshDeltaModulus"};
+  int m_MismatchMode = {0};
+  DataArrayPath m_SurfaceMeshFaceNormalsArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceNormals};
+  DataArrayPath m_FeaturePhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::Phases};
+  DataArrayPath m_AvgQuatsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::AvgQuats};
+  DataArrayPath m_CrystalStructuresArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellEnsembleAttributeMatrixName, SIMPL::EnsembleData::CrystalStructures};
+  DataArrayPath m_CrystalCompliancesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellEnsembleAttributeMatrixName, "CrystalCompliances"};
+  bool m_DeduplicatePairs = {false};
+  QString m_FaceFeatureAttributeMatrixName = {SIMPL::Defaults::FaceFeatureAttributeMatrixName};
+  QString m_FeatureFaceLabelsArrayName = {SIMPL::FaceData::SurfaceMeshFaceLabels};
+  QString m_FeatureFaceDeltaModulusArrayName = {"DeltaModulus"};
+  QString m_SurfaceMeshFeatureFaceIdsArrayName = {SIMPL::FaceData::SurfaceMeshFeatureFaceId};
+  bool m_StoreTriangleMismatch = {true};
+  bool m_ComputeStatistics = {false};
+  DataArrayPath m_SurfaceMeshFaceAreasArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceAreas};
+  int m_NumberOfBins = {100};
+  QString m_MismatchStatisticsAttributeMatrixName = {"MismatchStatistics"};
+  QString m_MismatchHistogramArrayName = {"AreaHistogram"};
+  QString m_MismatchHistogramBoundsArrayName = {"HistogramBounds"};
+  QString m_MismatchMeanArrayName = {"Mean"};
+  QString m_MismatchVarianceArrayName = {"Variance"};
+  QString m_MismatchPercentilesArrayName = {"Percentiles"};
+  bool m_StreamFromFile = {false};
+  QString m_StreamingInputFile = {""};
+  QString m_StreamingFaceLabelsDatasetPath = {"DataContainers/TriangleDataContainer/FaceData/FaceLabels"};
+  QString m_StreamingOutputFile = {""};
+  QString m_StreamingDeltaModulusDatasetPath = {"SurfaceMeshDeltaModulus"};
+  int m_StreamingChunkSize = {1048576};
 
   CubicOps::Pointer m_CubicOps;
   HexagonalOps::Pointer m_HexOps;
@@ -200,6 +605,18 @@ private:
    */
   void dataCheckSurfaceMesh();
 
+  /**
+   * @brief dataCheckStreaming Checks the parameters of the streaming mode and the face labels dataset of the input file
+   * @param numTriangles Set to the number of triangles in the face labels dataset
+   * @param labelSize Set to the size in bytes (4 or 8) of the stored labels
+   */
+  void dataCheckStreaming(int64_t& numTriangles, size_t& labelSize);
+
+  /**
+   * @brief executeStreaming Computes the per triangle mismatch chunk by chunk from the face labels of the input file into the output file
+   */
+  void executeStreaming();
+
 public:
   FindModulusMismatch(const FindModulusMismatch&) = delete;            // Copy Constructor Not Implemented
   FindModulusMismatch(FindModulusMismatch&&) = delete;                 // Move Constructor Not Implemented
@@ -17,32 +17,29 @@
 
 #include "GenerateMisorientationColors.h"
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Utilities/ColorTable.h"
 
-#include "UCSBUtilitiesFilters/LaueOps/CubicLowOpsMisoColor.h"
 #include "UCSBUtilitiesFilters/LaueOps/CubicOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/HexagonalLowOpsMisoColor.h"
 #include "UCSBUtilitiesFilters/LaueOps/HexagonalOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/MonoclinicOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/OrthoRhombicOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/TetragonalLowOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/TetragonalOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/TriclinicOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/TrigonalLowOpsMisoColor.h"
-#include "UCSBUtilitiesFilters/LaueOps/TrigonalOpsMisoColor.h"
 
 #include "UCSBUtilities/UCSBUtilitiesConstants.h"
 #include "UCSBUtilities/UCSBUtilitiesVersion.h"
@@ -64,16 +61,124 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID31 = 31,
 };
 
+namespace
+{
+/**
+ * @brief ColorPhaseRun computes the misorientation colors of a run of consecutive elements whose phase has the
+ * Laue class of MisoColorOps. The MisoColor classes are final, so the color of each element is computed without
+ * virtual dispatch. With useLookupTable the colors are interpolated in the Laue class's table of fundamental zone colors,
+ * with useFastMath they are computed in single precision.
+ */
+template <typename MisoColorOps>
+void ColorPhaseRun(const LaueOps& laueOps, const QuatD& refQuat, bool useLookupTable, bool useFastMath, const float* quats, const bool* goodVoxels, size_t start, size_t end, uint8_t* colors)
+{
+  const MisoColorOps& ops = static_cast<const MisoColorOps&>(laueOps);
+  for(size_t i = start; i < end; i++)
+  {
+    uint8_t* color = colors + i * 3;
+    if(nullptr != goodVoxels && !goodVoxels[i])
+    {
+      color[0] = 0;
+      color[1] = 0;
+      color[2] = 0;
+      continue;
+    }
+    const float* quat = quats + i * 4;
+    SIMPL::Rgb argb = ops.generateMisorientationColor(QuatD(quat[0], quat[1], quat[2], quat[3]), refQuat, useLookupTable, useFastMath);
+    color[0] = RgbColor::dRed(argb);
+    color[1] = RgbColor::dGreen(argb);
+    color[2] = RgbColor::dBlue(argb);
+  }
+}
+
+/**
+ * @brief Cubic runs are colored in blocks of CubicOpsMisoColor::k_BlockSize elements whose disorientations are searched
+ * together. Masked elements are colored with their block and then set to black.
+ */
+template <>
+void ColorPhaseRun<CubicOpsMisoColor>(const LaueOps& laueOps, const QuatD& refQuat, bool useLookupTable, bool useFastMath, const float* quats, const bool* goodVoxels, size_t start, size_t end, uint8_t* colors)
+{
+  const CubicOpsMisoColor& ops = static_cast<const CubicOpsMisoColor&>(laueOps);
+  std::array<SIMPL::Rgb, CubicOpsMisoColor::k_BlockSize> argbs = {};
+  for(size_t blockStart = start; blockStart < end; blockStart += CubicOpsMisoColor::k_BlockSize)
+  {
+    size_t count = std::min(CubicOpsMisoColor::k_BlockSize, end - blockStart);
+    ops.generateMisorientationColors(quats + blockStart * 4, count, refQuat, useLookupTable, useFastMath, argbs.data());
+    for(size_t j = 0; j < count; j++)
+    {
+      size_t i = blockStart + j;
+      uint8_t* color = colors + i * 3;
+      if(nullptr != goodVoxels && !goodVoxels[i])
+      {
+        color[0] = 0;
+        color[1] = 0;
+        color[2] = 0;
+        continue;
+      }
+      color[0] = RgbColor::dRed(argbs[j]);
+      color[1] = RgbColor::dGreen(argbs[j]);
+      color[2] = RgbColor::dBlue(argbs[j]);
+    }
+  }
+}
+
+using ColorPhaseRunFunc = void (*)(const LaueOps&, const QuatD&, bool, bool, const float*, const bool*, size_t, size_t, uint8_t*);
+
+/**
+ * @brief The MisorientationColorTable class holds one MisoColor instance and its ColorPhaseRun kernel for each Laue
+ * class that can be colored, and whether the kernels interpolate the colors in lookup tables or compute them in single
+ * precision. It is built once per execution and only read by the threads.
+ */
+class MisorientationColorTable
+{
+public:
+  MisorientationColorTable(bool useLookupTables, bool useFastMath)
+  : m_UseLookupTables(useLookupTables)
+  , m_UseFastMath(useFastMath)
+  {
+    m_Ops.fill(nullptr);
+    m_Kernels.fill(nullptr);
+    addLaueClass<HexagonalOpsMisoColor>(EbsdLib::CrystalStructure::Hexagonal_High);
+    addLaueClass<CubicOpsMisoColor>(EbsdLib::CrystalStructure::Cubic_High);
+  }
+
+  bool isSupported(uint32_t crystalStructure) const
+  {
+    return crystalStructure < EbsdLib::CrystalStructure::LaueGroupEnd && nullptr != m_Kernels[crystalStructure];
+  }
+
+  void colorPhaseRun(uint32_t crystalStructure, const QuatD& refQuat, const float* quats, const bool* goodVoxels, size_t start, size_t end, uint8_t* colors) const
+  {
+    m_Kernels[crystalStructure](*m_Ops[crystalStructure], refQuat, m_UseLookupTables, m_UseFastMath, quats, goodVoxels, start, end, colors);
+  }
+
+private:
+  template <typename MisoColorOps>
+  void addLaueClass(uint32_t crystalStructure)
+  {
+    m_Ops[crystalStructure] = MisoColorOps::New();
+    m_Kernels[crystalStructure] = &ColorPhaseRun<MisoColorOps>;
+  }
+
+  bool m_UseLookupTables = false;
+  bool m_UseFastMath = false;
+  std::array<LaueOps::Pointer, EbsdLib::CrystalStructure::LaueGroupEnd> m_Ops;
+  std::array<ColorPhaseRunFunc, EbsdLib::CrystalStructure::LaueGroupEnd> m_Kernels;
+};
+} // namespace
+
 /**
  * @brief The GenerateMisorientationColorsImpl class implements a threaded algorithm that computes the misorientation
- * colors for each element in a geometry.
+ * colors for each element in a geometry. Each range is split into runs of elements with the same phase that are colored
+ * by the kernel of the phase's Laue class.
  */
 class GenerateMisorientationColorsImpl
 {
 public:
-  GenerateMisorientationColorsImpl(FloatVec3Type referenceAxis, float refAngle, float* quats, int32_t* phases, uint32_t* crystalStructures, bool* goodVoxels, uint8_t* notSupported, uint8_t* colors)
-  : m_ReferenceAxis(referenceAxis)
-  , m_ReferenceAngle(refAngle)
+  GenerateMisorientationColorsImpl(const MisorientationColorTable& colorTable, const QuatD& refQuat, float* quats, int32_t* phases, uint32_t* crystalStructures, bool* goodVoxels,
+                                   uint8_t* notSupported, uint8_t* colors)
+  : m_ColorTable(colorTable)
+  , m_ReferenceQuat(refQuat)
   , m_Quats(quats)
   , m_CellPhases(phases)
   , m_CrystalStructures(crystalStructures)
@@ -82,70 +187,93 @@ public:
   , m_MisorientationColor(colors)
   {
   }
-  virtual ~GenerateMisorientationColorsImpl() = default;
 
   void convert(size_t start, size_t end) const
   {
-    QVector<LaueOps::Pointer> ops;
-    ops.push_back(HexagonalOpsMisoColor::New());
-
-    ops.push_back(CubicOpsMisoColor::New());
-
-    ops.push_back(HexagonalLowOpsMisoColor::New()); // Hex Low
-    ops.push_back(CubicLowOpsMisoColor::New());     // Cubic Low
-    ops.push_back(TriclinicOpsMisoColor::New());    // Triclinic
-    ops.push_back(MonoclinicOpsMisoColor::New());   // Monoclinic
-
-    ops.push_back(OrthoRhombicOpsMisoColor::New()); // OrthoRhombic
-
-    ops.push_back(TetragonalLowOpsMisoColor::New()); // Tetragonal-low
-    ops.push_back(TetragonalOpsMisoColor::New());    // Tetragonal-high
+    size_t runStart = start;
+    while(runStart < end)
+    {
+      int32_t phase = m_CellPhases[runStart];
+      size_t runEnd = runStart + 1;
+      while(runEnd < end && m_CellPhases[runEnd] == phase)
+      {
+        runEnd++;
+      }
 
-    ops.push_back(TrigonalLowOpsMisoColor::New()); // Trigonal-low
-    ops.push_back(TrigonalOpsMisoColor::New());    // Trigonal-High
+      uint32_t crystalStructure = m_CrystalStructures[phase];
+      if(m_ColorTable.isSupported(crystalStructure))
+      {
+        m_ColorTable.colorPhaseRun(crystalStructure, m_ReferenceQuat, m_Quats, m_GoodVoxels, runStart, runEnd, m_MisorientationColor);
+      }
+      else
+      {
+        // Laue classes without a misorientation coloring are flagged, unknown crystal structures are silently black
+        if(crystalStructure < EbsdLib::CrystalStructure::LaueGroupEnd)
+        {
+          m_NotSupported[crystalStructure] = 1;
+        }
+        std::fill(m_MisorientationColor + runStart * 3, m_MisorientationColor + runEnd * 3, static_cast<uint8_t>(0));
+      }
+      runStart = runEnd;
+    }
+  }
 
-    ops.push_back(OrthoRhombicOpsMisoColor::New()); // Axis OrthorhombicOps
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+private:
+  const MisorientationColorTable& m_ColorTable;
+  QuatD m_ReferenceQuat;
+  float* m_Quats;
+  int32_t* m_CellPhases;
+  uint32_t* m_CrystalStructures;
+  bool* m_GoodVoxels;
+  uint8_t* m_NotSupported;
+  uint8_t* m_MisorientationColor;
+};
 
-    Quaternion<double> refQuat = {m_ReferenceAxis[0] * sinf(m_ReferenceAngle), m_ReferenceAxis[1] * sinf(m_ReferenceAngle), m_ReferenceAxis[2] * sinf(m_ReferenceAngle), cosf(m_ReferenceAngle)};
-    Quaternion<double> cellQuat = {0.0f, 0.0f, 0.0f, 1.0f};
-    SIMPL::Rgb argb = 0x00000000;
+/**
+ * @brief The BroadcastFeatureColorsImpl class implements a threaded algorithm that copies the misorientation color of
+ * each element's Feature into the element colors.
+ */
+class BroadcastFeatureColorsImpl
+{
+public:
+  BroadcastFeatureColorsImpl(const uint8_t* featureColors, size_t numFeatures, int32_t* featureIds, bool* goodVoxels, uint8_t* invalidFeatureIds, uint8_t* colors)
+  : m_FeatureColors(featureColors)
+  , m_NumFeatures(numFeatures)
+  , m_FeatureIds(featureIds)
+  , m_GoodVoxels(goodVoxels)
+  , m_InvalidFeatureIds(invalidFeatureIds)
+  , m_MisorientationColor(colors)
+  {
+  }
 
-    bool missingGoodVoxels = false;
-    if(nullptr == m_GoodVoxels)
-    {
-      missingGoodVoxels = true;
-    }
-    int32_t phase = 0;
-    size_t index = 0;
+  void convert(size_t start, size_t end) const
+  {
     for(size_t i = start; i < end; i++)
     {
-      phase = m_CellPhases[i];
-      index = i * 3;
-      m_MisorientationColor[index] = 0;
-      m_MisorientationColor[index + 1] = 0;
-      m_MisorientationColor[index + 2] = 0;
-      cellQuat = Quaternion<double>(m_Quats[i * 4], m_Quats[i * 4 + 1], m_Quats[i * 4 + 2], m_Quats[i * 4 + 3]);
-
-      if(m_CrystalStructures[phase] == EbsdLib::CrystalStructure::Cubic_Low || m_CrystalStructures[phase] == EbsdLib::CrystalStructure::Hexagonal_Low)
+      uint8_t* color = m_MisorientationColor + i * 3;
+      int32_t featureId = m_FeatureIds[i];
+      bool validFeatureId = featureId >= 0 && static_cast<size_t>(featureId) < m_NumFeatures;
+      if(!validFeatureId || (nullptr != m_GoodVoxels && !m_GoodVoxels[i]))
       {
-        uint32_t idx = m_CrystalStructures[phase];
-        if(idx == EbsdLib::CrystalStructure::UnknownCrystalStructure)
+        if(!validFeatureId)
         {
-          idx = 12;
+          *m_InvalidFeatureIds = 1;
         }
-        m_NotSupported[idx] = 1;
-        m_MisorientationColor[index] = 0;
-        m_MisorientationColor[index + 1] = 0;
-        m_MisorientationColor[index + 2] = 0;
-      }
-      // Make sure we are using a valid Euler Angles with valid crystal symmetry
-      else if((missingGoodVoxels || m_GoodVoxels[i]) && m_CrystalStructures[phase] < EbsdLib::CrystalStructure::LaueGroupEnd)
-      {
-        argb = ops[m_CrystalStructures[phase]]->generateMisorientationColor(cellQuat, refQuat);
-        m_MisorientationColor[index] = RgbColor::dRed(argb);
-        m_MisorientationColor[index + 1] = RgbColor::dGreen(argb);
-        m_MisorientationColor[index + 2] = RgbColor::dBlue(argb);
+        color[0] = 0;
+        color[1] = 0;
+        color[2] = 0;
+        continue;
       }
+      const uint8_t* featureColor = m_FeatureColors + static_cast<size_t>(featureId) * 3;
+      color[0] = featureColor[0];
+      color[1] = featureColor[1];
+      color[2] = featureColor[2];
     }
   }
 
@@ -156,13 +284,11 @@ public:
   }
 #endif
 private:
-  FloatVec3Type m_ReferenceAxis;
-  float m_ReferenceAngle;
-  float* m_Quats;
-  int32_t* m_CellPhases;
-  uint32_t* m_CrystalStructures;
+  const uint8_t* m_FeatureColors;
+  size_t m_NumFeatures;
+  int32_t* m_FeatureIds;
   bool* m_GoodVoxels;
-  uint8_t* m_NotSupported;
+  uint8_t* m_InvalidFeatureIds;
   uint8_t* m_MisorientationColor;
 };
 
@@ -191,30 +317,60 @@ void GenerateMisorientationColors::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Reference Orientation Axis", ReferenceAxis, FilterParameter::Category::Parameter, GenerateMisorientationColors));
 
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Reference Orientation Angle (Degrees)", ReferenceAngle, FilterParameter::Category::Parameter, GenerateMisorientationColors));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Orientation Source");
+    parameter->setPropertyName("OrientationSource");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(GenerateMisorientationColors, this, OrientationSource));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(GenerateMisorientationColors, this, OrientationSource));
+    parameter->setDefaultValue(getOrientationSource());
+    std::vector<QString> choices = {"Element Orientations", "Feature Average Orientations"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedChoiceProps = {"QuatsArrayPath", "CellPhasesArrayPath", "FeatureIdsArrayPath", "AvgQuatsArrayPath", "FeaturePhasesArrayPath"};
+    parameter->setLinkedProperties(linkedChoiceProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Interpolate Colors in Lookup Tables", UseLookupTables, FilterParameter::Category::Parameter, GenerateMisorientationColors));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Compute Colors in Single Precision", UseFastMath, FilterParameter::Category::Parameter, GenerateMisorientationColors));
   std::vector<QString> linkedProps = {"GoodVoxelsArrayPath"};
   parameters.push_back(
       SIMPL_NEW_LINKED_BOOL_FP("Apply to Good Elements Only (Bad Elements Will Be Black)", UseGoodVoxels, FilterParameter::Category::Parameter, GenerateMisorientationColors, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Element Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Category::Any);
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Quaternions", QuatsArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Quaternions", QuatsArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req, 0));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Any);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Phases", CellPhasesArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req, 0));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Any);
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Phases", CellPhasesArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req, 1));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Any);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", GoodVoxelsArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req));
   }
+  parameters.push_back(SeparatorFilterParameter::Create("Feature Data", FilterParameter::Category::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Category::Feature);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Average Quaternions", AvgQuatsArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req, 1));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Feature);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Phases", FeaturePhasesArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req, 1));
+  }
   parameters.push_back(SeparatorFilterParameter::Create("Ensemble Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::UInt32, 1, AttributeMatrix::Category::Ensemble);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Crystal Structures", CrystalStructuresArrayPath, FilterParameter::Category::RequiredArray, GenerateMisorientationColors, req));
   }
   parameters.push_back(SeparatorFilterParameter::Create("Element Data", FilterParameter::Category::CreatedArray));
-  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Misorientation Colors", MisorientationColorArrayName, CellPhasesArrayPath, CellPhasesArrayPath, FilterParameter::Category::CreatedArray,
-                                                      GenerateMisorientationColors));
+  // the colors are created next to the Phases (Element Orientations) or the Feature Ids (Feature Average Orientations)
+  parameters.push_back(SIMPL_NEW_STRING_FP("Misorientation Colors", MisorientationColorArrayName, FilterParameter::Category::CreatedArray, GenerateMisorientationColors));
   setFilterParameters(parameters);
 }
 
@@ -232,6 +388,12 @@ void GenerateMisorientationColors::readFilterParameters(AbstractFilterParameters
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setReferenceAxis(reader->readFloatVec3("ReferenceAxis", getReferenceAxis()));
   setReferenceAngle(reader->readValue("ReferenceAngle", getReferenceAngle()));
+  setOrientationSource(reader->readValue("OrientationSource", getOrientationSource()));
+  setUseLookupTables(reader->readValue("UseLookupTables", getUseLookupTables()));
+  setUseFastMath(reader->readValue("UseFastMath", getUseFastMath()));
+  setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
+  setAvgQuatsArrayPath(reader->readDataArrayPath("AvgQuatsArrayPath", getAvgQuatsArrayPath()));
+  setFeaturePhasesArrayPath(reader->readDataArrayPath("FeaturePhasesArrayPath", getFeaturePhasesArrayPath()));
   reader->closeFilterGroup();
 }
 
@@ -254,25 +416,67 @@ void GenerateMisorientationColors::dataCheck()
   QVector<DataArrayPath> dataArrayPaths;
 
   std::vector<size_t> cDims(1, 1);
-  m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getCellPhasesArrayPath(), cDims);
-  if(nullptr != m_CellPhasesPtr.lock())
-  {
-    m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
-  if(getErrorCode() >= 0)
+  DataArrayPath elementPath = getCellPhasesArrayPath();
+  if(0 == getOrientationSource())
   {
-    dataArrayPaths.push_back(getCellPhasesArrayPath());
-  }
+    m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getCellPhasesArrayPath(), cDims);
+    if(nullptr != m_CellPhasesPtr.lock())
+    {
+      m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      dataArrayPaths.push_back(getCellPhasesArrayPath());
+    }
 
-  cDims[0] = 4;
-  m_QuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getQuatsArrayPath(), cDims);
-  if(nullptr != m_QuatsPtr.lock())
-  {
-    m_Quats = m_QuatsPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
-  if(getErrorCode() >= 0)
+    cDims[0] = 4;
+    m_QuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getQuatsArrayPath(), cDims);
+    if(nullptr != m_QuatsPtr.lock())
+    {
+      m_Quats = m_QuatsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      dataArrayPaths.push_back(getQuatsArrayPath());
+    }
+  }
+  else
   {
-    dataArrayPaths.push_back(getQuatsArrayPath());
+    // the colors are computed per Feature and stored with the Feature Ids
+    elementPath = getFeatureIdsArrayPath();
+    m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeatureIdsArrayPath(), cDims);
+    if(nullptr != m_FeatureIdsPtr.lock())
+    {
+      m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      dataArrayPaths.push_back(getFeatureIdsArrayPath());
+    }
+
+    QVector<DataArrayPath> featureDataArrayPaths;
+    cDims[0] = 4;
+    m_AvgQuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getAvgQuatsArrayPath(), cDims);
+    if(nullptr != m_AvgQuatsPtr.lock())
+    {
+      m_AvgQuats = m_AvgQuatsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      featureDataArrayPaths.push_back(getAvgQuatsArrayPath());
+    }
+
+    cDims[0] = 1;
+    m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeaturePhasesArrayPath(), cDims);
+    if(nullptr != m_FeaturePhasesPtr.lock())
+    {
+      m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      featureDataArrayPaths.push_back(getFeaturePhasesArrayPath());
+    }
+    getDataContainerArray()->validateNumberOfTuples(this, featureDataArrayPaths);
   }
 
   cDims[0] = 1;
@@ -283,7 +487,7 @@ void GenerateMisorientationColors::dataCheck()
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
   cDims[0] = 3;
-  tempPath.update(getCellPhasesArrayPath().getDataContainerName(), getCellPhasesArrayPath().getAttributeMatrixName(), getMisorientationColorArrayName());
+  tempPath.update(elementPath.getDataContainerName(), elementPath.getAttributeMatrixName(), getMisorientationColorArrayName());
   m_MisorientationColorPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>>(this, tempPath, 0, cDims, "", DataArrayID31);
   if(nullptr != m_MisorientationColorPtr.lock())
   {
@@ -325,28 +529,64 @@ void GenerateMisorientationColors::execute()
     return;
   }
 
-  size_t totalPoints = m_CellPhasesPtr.lock()->getNumberOfTuples();
+  size_t totalPoints = m_MisorientationColorPtr.lock()->getNumberOfTuples();
 
   // Make sure we are dealing with a unit 1 vector.
   FloatVec3Type normRefDir = m_ReferenceAxis; // Make a copy of the reference Direction
 
   MatrixMath::Normalize3x1(normRefDir[0], normRefDir[1], normRefDir[2]);
-  // Create 1 of every type of Ops class. This condenses the code below
+  QuatD refQuat = {normRefDir[0] * sinf(m_ReferenceAngle), normRefDir[1] * sinf(m_ReferenceAngle), normRefDir[2] * sinf(m_ReferenceAngle), cosf(m_ReferenceAngle)};
+
+  // One MisoColor instance per supported Laue class, shared (read only) by all threads
+  MisorientationColorTable colorTable(getUseLookupTables(), getUseFastMath());
   UInt8ArrayType::Pointer notSupported = UInt8ArrayType::CreateArray(13, std::string("_INTERNAL_USE_ONLY_NotSupportedArray"), true);
   notSupported->initializeWithZeros();
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  if(true)
+  if(0 == getOrientationSource())
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints),
-                      GenerateMisorientationColorsImpl(normRefDir, m_ReferenceAngle, m_Quats, m_CellPhases, m_CrystalStructures, m_GoodVoxels, notSupported->getPointer(0), m_MisorientationColor),
-                      tbb::auto_partitioner());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints),
+                        GenerateMisorientationColorsImpl(colorTable, refQuat, m_Quats, m_CellPhases, m_CrystalStructures, m_GoodVoxels, notSupported->getPointer(0), m_MisorientationColor),
+                        tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      GenerateMisorientationColorsImpl serial(colorTable, refQuat, m_Quats, m_CellPhases, m_CrystalStructures, m_GoodVoxels, notSupported->getPointer(0), m_MisorientationColor);
+      serial.convert(0, totalPoints);
+    }
   }
   else
-#endif
   {
-    GenerateMisorientationColorsImpl serial(normRefDir, m_ReferenceAngle, m_Quats, m_CellPhases, m_CrystalStructures, m_GoodVoxels, notSupported->getPointer(0), m_MisorientationColor);
-    serial.convert(0, totalPoints);
+    // Color each Feature once from its average orientation, then copy the colors to the elements
+    size_t numFeatures = m_AvgQuatsPtr.lock()->getNumberOfTuples();
+    std::vector<uint8_t> featureColors(numFeatures * 3, 0);
+    uint8_t invalidFeatureIds = 0;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures),
+                        GenerateMisorientationColorsImpl(colorTable, refQuat, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, nullptr, notSupported->getPointer(0), featureColors.data()),
+                        tbb::auto_partitioner());
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints),
+                        BroadcastFeatureColorsImpl(featureColors.data(), numFeatures, m_FeatureIds, m_GoodVoxels, &invalidFeatureIds, m_MisorientationColor), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      GenerateMisorientationColorsImpl serial(colorTable, refQuat, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, nullptr, notSupported->getPointer(0), featureColors.data());
+      serial.convert(0, numFeatures);
+      BroadcastFeatureColorsImpl broadcast(featureColors.data(), numFeatures, m_FeatureIds, m_GoodVoxels, &invalidFeatureIds, m_MisorientationColor);
+      broadcast.convert(0, totalPoints);
+    }
+
+    if(invalidFeatureIds == 1)
+    {
+      QString msg = QObject::tr("Some Feature Ids are outside of the range of the Feature Data %1. These elements have been set to black").arg(getAvgQuatsArrayPath().getAttributeMatrixName());
+      setWarningCondition(-5002, msg);
+    }
   }
 
   std::vector<LaueOps::Pointer> ops = LaueOps::GetAllOrientationOps();
@@ -567,3 +807,75 @@ bool GenerateMisorientationColors::getUseGoodVoxels() const
 {
   return m_UseGoodVoxels;
 }
+
+// -----------------------------------------------------------------------------
+void GenerateMisorientationColors::setOrientationSource(int value)
+{
+  m_OrientationSource = value;
+}
+
+// -----------------------------------------------------------------------------
+int GenerateMisorientationColors::getOrientationSource() const
+{
+  return m_OrientationSource;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateMisorientationColors::setFeatureIdsArrayPath(const DataArrayPath& value)
+{
+  m_FeatureIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath GenerateMisorientationColors::getFeatureIdsArrayPath() const
+{
+  return m_FeatureIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateMisorientationColors::setAvgQuatsArrayPath(const DataArrayPath& value)
+{
+  m_AvgQuatsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath GenerateMisorientationColors::getAvgQuatsArrayPath() const
+{
+  return m_AvgQuatsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateMisorientationColors::setFeaturePhasesArrayPath(const DataArrayPath& value)
+{
+  m_FeaturePhasesArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath GenerateMisorientationColors::getFeaturePhasesArrayPath() const
+{
+  return m_FeaturePhasesArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateMisorientationColors::setUseLookupTables(bool value)
+{
+  m_UseLookupTables = value;
+}
+
+// -----------------------------------------------------------------------------
+bool GenerateMisorientationColors::getUseLookupTables() const
+{
+  return m_UseLookupTables;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateMisorientationColors::setUseFastMath(bool value)
+{
+  m_UseFastMath = value;
+}
+
+// -----------------------------------------------------------------------------
+bool GenerateMisorientationColors::getUseFastMath() const
+{
+  return m_UseFastMath;
+}
@@ -46,6 +46,12 @@ class UCSBUtilities_EXPORT GenerateMisorientationColors : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath GoodVoxelsArrayPath READ getGoodVoxelsArrayPath WRITE setGoodVoxelsArrayPath)
   PYB11_PROPERTY(QString MisorientationColorArrayName READ getMisorientationColorArrayName WRITE setMisorientationColorArrayName)
   PYB11_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
+  PYB11_PROPERTY(int OrientationSource READ getOrientationSource WRITE setOrientationSource)
+  PYB11_PROPERTY(bool UseLookupTables READ getUseLookupTables WRITE setUseLookupTables)
+  PYB11_PROPERTY(bool UseFastMath READ getUseFastMath WRITE setUseFastMath)
+  PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+  PYB11_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
+  PYB11_PROPERTY(DataArrayPath FeaturePhasesArrayPath READ getFeaturePhasesArrayPath WRITE setFeaturePhasesArrayPath)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -166,6 +172,78 @@ public:
 
   Q_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
 
+  /**
+   * @brief Setter property for OrientationSource
+   */
+  void setOrientationSource(int value);
+  /**
+   * @brief Getter property for OrientationSource
+   * @return Value of OrientationSource
+   */
+  int getOrientationSource() const;
+
+  Q_PROPERTY(int OrientationSource READ getOrientationSource WRITE setOrientationSource)
+
+  /**
+   * @brief Setter property for UseLookupTables
+   */
+  void setUseLookupTables(bool value);
+  /**
+   * @brief Getter property for UseLookupTables
+   * @return Value of UseLookupTables
+   */
+  bool getUseLookupTables() const;
+
+  Q_PROPERTY(bool UseLookupTables READ getUseLookupTables WRITE setUseLookupTables)
+
+  /**
+   * @brief Setter property for UseFastMath
+   */
+  void setUseFastMath(bool value);
+  /**
+   * @brief Getter property for UseFastMath
+   * @return Value of UseFastMath
+   */
+  bool getUseFastMath() const;
+
+  Q_PROPERTY(bool UseFastMath READ getUseFastMath WRITE setUseFastMath)
+
+  /**
+   * @brief Setter property for FeatureIdsArrayPath
+   */
+  void setFeatureIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeatureIdsArrayPath
+   * @return Value of FeatureIdsArrayPath
+   */
+  DataArrayPath getFeatureIdsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+
+  /**
+   * @brief Setter property for AvgQuatsArrayPath
+   */
+  void setAvgQuatsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for AvgQuatsArrayPath
+   * @return Value of AvgQuatsArrayPath
+   */
+  DataArrayPath getAvgQuatsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
+
+  /**
+   * @brief Setter property for FeaturePhasesArrayPath
+   */
+  void setFeaturePhasesArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeaturePhasesArrayPath
+   * @return Value of FeaturePhasesArrayPath
+   */
+  DataArrayPath getFeaturePhasesArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath FeaturePhasesArrayPath READ getFeaturePhasesArrayPath WRITE setFeaturePhasesArrayPath)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -250,6 +328,12 @@ private:
   bool* m_GoodVoxels = nullptr;
   std::weak_ptr<DataArray<uint8_t>> m_MisorientationColorPtr;
   uint8_t* m_MisorientationColor = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeatureIdsPtr;
+  int32_t* m_FeatureIds = nullptr;
+  std::weak_ptr<DataArray<float>> m_AvgQuatsPtr;
+  float* m_AvgQuats = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeaturePhasesPtr;
+  int32_t* m_FeaturePhases = nullptr;
 
   FloatVec3Type m_ReferenceAxis = {};
   float m_ReferenceAngle = {0.0f};
@@ -259,6 +343,12 @@ private:
   DataArrayPath m_GoodVoxelsArrayPath = {"", "", ""};
   QString m_MisorientationColorArrayName = {SIMPL::CellData::MisorientationColor};
   bool m_UseGoodVoxels = {false};
+  int m_OrientationSource = {0};
+  bool m_UseLookupTables = {false};
+  bool m_UseFastMath = {false};
+  DataArrayPath m_FeatureIdsArrayPath = {"", "", ""};
+  DataArrayPath m_AvgQuatsArrayPath = {"", "", ""};
+  DataArrayPath m_FeaturePhasesArrayPath = {"", "", ""};
 
 public:
   GenerateMisorientationColors(const GenerateMisorientationColors&) = delete;            // Copy Constructor Not Implemented
@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class CubicLowOpsMisoColor : public CubicLowOps
+class CubicLowOpsMisoColor final : public CubicLowOps
 {
 public:
   using Self = CubicLowOpsMisoColor;
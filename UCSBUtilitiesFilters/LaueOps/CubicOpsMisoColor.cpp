@@ -17,12 +17,20 @@
 
 #include "CubicOpsMisoColor.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 // Include this FIRST because there is a needed define for some compiles
 // to expose some of the constants needed below
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Utilities/ColorUtilities.h"
 
+#include "UCSBUtilitiesFilters/util/FundamentalZoneColorTable.h"
+#include "UCSBUtilitiesFilters/util/MisorientationColorMath.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -93,37 +101,59 @@ void _TripletSort(T a, T b, T c, T& x, T& y, T& z)
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-SIMPL::Rgb CubicOpsMisoColor::generateMisorientationColor(const QuatD& q, const QuatD& refFrame) const
+namespace
 {
-  // double n1, n2, n3, w;
-  double x, x1, x2, x3, x4, x5, x6, x7;
-  double y, y1, y2, y3, y4, y5, y6, y7;
-  double z, z1, z2, z3, z4, z5, z6, z7;
-  double k, h, s, v;
-
-  QuatD q1 = q;
-  QuatD q2 = refFrame;
-
-  // get disorientation
-  OrientationD axisAngle = CubicOps::calculateMisorientation(q1, q2);
-  axisAngle[0] = fabs(axisAngle[0]);
-  axisAngle[1] = fabs(axisAngle[1]);
-  axisAngle[2] = fabs(axisAngle[2]);
+// The 24 rotations of the cubic (432) point group as quaternions, stored as structure of arrays so that the
+// disorientation search over a block of misorientations vectorizes
+constexpr size_t k_NumCubicSymOps = 24;
+constexpr double k_HalfSqrt2 = 0.70710678118654752440;
+constexpr std::array<double, k_NumCubicSymOps> k_CubicSymW = {1.0, 0.0, 0.0, 0.0, k_HalfSqrt2, k_HalfSqrt2, k_HalfSqrt2, k_HalfSqrt2, k_HalfSqrt2, k_HalfSqrt2, 0.0, 0.0,
+                                                              0.0, 0.0, 0.0, 0.0, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5};
+constexpr std::array<double, k_NumCubicSymOps> k_CubicSymX = {0.0, 1.0, 0.0, 0.0, k_HalfSqrt2, -k_HalfSqrt2, 0.0, 0.0, 0.0, 0.0, k_HalfSqrt2, k_HalfSqrt2,
+                                                              k_HalfSqrt2, k_HalfSqrt2, 0.0, 0.0, 0.5, 0.5, 0.5, 0.5, -0.5, -0.5, -0.5, -0.5};
+constexpr std::array<double, k_NumCubicSymOps> k_CubicSymY = {0.0, 0.0, 1.0, 0.0, 0.0, 0.0, k_HalfSqrt2, -k_HalfSqrt2, 0.0, 0.0, k_HalfSqrt2, -k_HalfSqrt2,
+                                                              0.0, 0.0, k_HalfSqrt2, k_HalfSqrt2, 0.5, 0.5, -0.5, -0.5, 0.5, 0.5, -0.5, -0.5};
+constexpr std::array<double, k_NumCubicSymOps> k_CubicSymZ = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, k_HalfSqrt2, -k_HalfSqrt2, 0.0, 0.0,
+                                                              k_HalfSqrt2, -k_HalfSqrt2, k_HalfSqrt2, -k_HalfSqrt2, 0.5, -0.5, 0.5, -0.5, 0.5, -0.5, 0.5, -0.5};
 
-  _TripletSort(axisAngle[0], axisAngle[1], axisAngle[2], z, y, x);
-
-  // eq c9.1
-  k = tan(axisAngle[3] / 2.0f);
-  x = x * k;
-  y = y * k;
-  z = z * k;
+/**
+ * @brief Computes the misorientation color of a cubic disorientation from its Rodrigues vector (eq. c9.1 - c9.8) with
+ * the precision of Math, only the magnitudes of the components are used
+ * @return false if the branch of eq. c9.2 can not be decided with the precision of Math
+ */
+template <typename Math>
+bool RodriguesVectorColor(typename Math::ValueType r1, typename Math::ValueType r2, typename Math::ValueType r3, SIMPL::Rgb& rgb)
+{
+  using T = typename Math::ValueType;
+  const T k_1Over3 = static_cast<T>(SIMPLib::Constants::k_1Over3D);
+  const T k_Tan_OneEigthPi = static_cast<T>(SIMPLib::Constants::k_Tan_OneEigthPiD);
+  const T k_Cos_OneEigthPi = static_cast<T>(SIMPLib::Constants::k_Cos_OneEigthPiD);
+  const T k_Cos_ThreeEightPi = static_cast<T>(SIMPLib::Constants::k_Cos_ThreeEightPiD);
+  const T k_Sin_ThreeEightPi = static_cast<T>(SIMPLib::Constants::k_Sin_ThreeEightPiD);
+  const T k_Sqrt3 = static_cast<T>(SIMPLib::Constants::k_Sqrt3D);
+  const T k_2Pi = static_cast<T>(SIMPLib::Constants::k_2PiD);
+
+  T x, x1, x2, x3, x4, x5, x6, x7;
+  T y, y1, y2, y3, y4, y5, y6, y7;
+  T z, z1, z2, z3, z4, z5, z6, z7;
+  T k, h, s, v;
+
+  _TripletSort(std::fabs(r1), std::fabs(r2), std::fabs(r3), z, y, x);
 
   // eq c9.2
   x1 = x;
-  if(x >= SIMPLib::Constants::k_1Over3D && atan2(z, y) >= ((1.0f - 2.0f * x) / x))
+  bool fold = false;
+  if(x >= k_1Over3)
+  {
+    T angle = Math::Atan2(z, y);
+    T limit = (1.0f - 2.0f * x) / x;
+    if(Math::IsAmbiguous(angle, limit))
+    {
+      return false;
+    }
+    fold = angle >= limit;
+  }
+  if(fold)
   {
     y1 = (x * (y + z)) / (1.0f - x);
     z1 = (x * z * (y + z)) / (y * (1.0f - x));
@@ -135,55 +165,234 @@ SIMPL::Rgb CubicOpsMisoColor::generateMisorientationColor(const QuatD& q, const
   }
 
   // eq c9.3
-  x2 = x1 - SIMPLib::Constants::k_Tan_OneEigthPiD;
-  y2 = y1 * SIMPLib::Constants::k_Cos_ThreeEightPiD - z1 * SIMPLib::Constants::k_Sin_ThreeEightPiD;
-  z2 = y1 * SIMPLib::Constants::k_Sin_ThreeEightPiD + z1 * SIMPLib::Constants::k_Cos_ThreeEightPiD;
+  x2 = x1 - k_Tan_OneEigthPi;
+  y2 = y1 * k_Cos_ThreeEightPi - z1 * k_Sin_ThreeEightPi;
+  z2 = y1 * k_Sin_ThreeEightPi + z1 * k_Cos_ThreeEightPi;
 
   // eq c9.4
   x3 = x2;
-  y3 = y2 * (1.0f + (y2 / z2) * SIMPLib::Constants::k_Tan_OneEigthPiD);
-  z3 = z2 + y2 * SIMPLib::Constants::k_Tan_OneEigthPiD;
+  y3 = y2 * (1.0f + (y2 / z2) * k_Tan_OneEigthPi);
+  z3 = z2 + y2 * k_Tan_OneEigthPi;
 
   // eq c9.5
   x4 = x3;
-  y4 = (y3 * SIMPLib::Constants::k_Cos_OneEigthPiD) / SIMPLib::Constants::k_Tan_OneEigthPiD;
-  z4 = z3 - x3 / SIMPLib::Constants::k_Cos_OneEigthPiD;
+  y4 = (y3 * k_Cos_OneEigthPi) / k_Tan_OneEigthPi;
+  z4 = z3 - x3 / k_Cos_OneEigthPi;
 
   // eq c9.6
-  k = atan2(-x4, y4);
-  x5 = x4 * (sin(k) + fabs(cos(k)));
-  y5 = y4 * (sin(k) + fabs(cos(k)));
+  k = Math::Atan2(-x4, y4);
+  x5 = x4 * (Math::Sin(k) + std::fabs(Math::Cos(k)));
+  y5 = y4 * (Math::Sin(k) + std::fabs(Math::Cos(k)));
   z5 = z4;
 
   // eq c9.7
-  k = atan2(-x5, y5);
-  x6 = -sqrt(x5 * x5 + y5 * y5) * sin(2.0f * k);
-  y6 = sqrt(x5 * x5 + y5 * y5) * cos(2.0f * k);
+  k = Math::Atan2(-x5, y5);
+  x6 = -Math::Sqrt(x5 * x5 + y5 * y5) * Math::Sin(2.0f * k);
+  y6 = Math::Sqrt(x5 * x5 + y5 * y5) * Math::Cos(2.0f * k);
   z6 = z5;
 
   // eq c9.8 these hsv are from 0 to 1 in cartesian coordinates
-  x7 = (x6 * SIMPLib::Constants::k_Sqrt3D - y6) / (2.0f * SIMPLib::Constants::k_Tan_OneEigthPiD);
-  y7 = (x6 + y6 * SIMPLib::Constants::k_Sqrt3D) / (2.0f * SIMPLib::Constants::k_Tan_OneEigthPiD);
-  z7 = z6 * (SIMPLib::Constants::k_Cos_OneEigthPiD / SIMPLib::Constants::k_Tan_OneEigthPiD);
+  x7 = (x6 * k_Sqrt3 - y6) / (2.0f * k_Tan_OneEigthPi);
+  y7 = (x6 + y6 * k_Sqrt3) / (2.0f * k_Tan_OneEigthPi);
+  z7 = z6 * (k_Cos_OneEigthPi / k_Tan_OneEigthPi);
 
   // convert to traditional hsv (0-1)
-  h = atan2(y7, x7);
+  h = Math::Atan2(y7, x7);
   if(h < 0.0f)
   {
-    h += SIMPLib::Constants::k_2PiD;
+    h += k_2Pi;
   }
-  h /= SIMPLib::Constants::k_2PiD;
-  s = sqrt(x7 * x7 + y7 * y7);
+  h /= k_2Pi;
+  s = Math::Sqrt(x7 * x7 + y7 * y7);
   v = z7;
   if(v > 0.0f)
   {
     s = s / v;
   }
 
-  SIMPL::Rgb rgb = ColorUtilities::ConvertHSVtoRgb(h, s, v);
+  SIMPL::Rgb hsvRgb = ColorUtilities::ConvertHSVtoRgb(h, s, v);
 
   // now standard 0-255 rgb, needs rotation
-  return RgbColor::dRgb(255 - RgbColor::dGreen(rgb), RgbColor::dBlue(rgb), RgbColor::dRed(rgb), 0);
+  rgb = RgbColor::dRgb(255 - RgbColor::dGreen(hsvRgb), RgbColor::dBlue(hsvRgb), RgbColor::dRed(hsvRgb), 0);
+  return true;
+}
+
+/**
+ * @brief Computes the exact misorientation color of a cubic disorientation from its Rodrigues vector, this is also the
+ * map sampled by the lookup table
+ */
+SIMPL::Rgb ExactRodriguesVectorColor(double r1, double r2, double r3)
+{
+  SIMPL::Rgb rgb = 0;
+  RodriguesVectorColor<ExactColorMath>(r1, r2, r3, rgb);
+  return rgb;
+}
+
+/**
+ * @brief Colors a block of orientations with the precision of Math, searching the disorientations of the whole block
+ * together over the cubic symmetry operators
+ * @param table Lookup table to interpolate the colors in, nullptr to compute them
+ * @param ambiguous Set for the orientations whose color could not be computed with the precision of Math
+ */
+template <typename Math>
+void ColorBlock(const float* quats, size_t count, const QuatD& refFrame, const FundamentalZoneColorTable* table, SIMPL::Rgb* rgbs, std::array<bool, CubicOpsMisoColor::k_BlockSize>& ambiguous)
+{
+  using T = typename Math::ValueType;
+  constexpr size_t k_BlockSize = CubicOpsMisoColor::k_BlockSize;
+
+  // misorientations q * refFrame^-1 of the block, unused lanes are the identity
+  std::array<T, k_BlockSize> qx = {};
+  std::array<T, k_BlockSize> qy = {};
+  std::array<T, k_BlockSize> qz = {};
+  std::array<T, k_BlockSize> qw = {};
+  T rx = static_cast<T>(-refFrame.x());
+  T ry = static_cast<T>(-refFrame.y());
+  T rz = static_cast<T>(-refFrame.z());
+  T rw = static_cast<T>(refFrame.w());
+  for(size_t i = 0; i < k_BlockSize; i++)
+  {
+    if(i >= count)
+    {
+      qw[i] = 1.0f;
+      continue;
+    }
+    T x = quats[i * 4];
+    T y = quats[i * 4 + 1];
+    T z = quats[i * 4 + 2];
+    T w = quats[i * 4 + 3];
+    qx[i] = w * rx + x * rw + y * rz - z * ry;
+    qy[i] = w * ry - x * rz + y * rw + z * rx;
+    qz[i] = w * rz + x * ry - y * rx + z * rw;
+    qw[i] = w * rw - x * rx - y * ry - z * rz;
+  }
+
+  // the disorientation is the symmetric equivalent with the largest |w| (smallest rotation angle), the runner up is
+  // tracked to detect ties that the scalar search may resolve to another equivalent
+  std::array<T, k_BlockSize> maxW = {};
+  std::array<T, k_BlockSize> secondW = {};
+  std::array<size_t, k_BlockSize> bestOp = {};
+  for(size_t i = 0; i < k_BlockSize; i++)
+  {
+    maxW[i] = std::fabs(qw[i]);
+    secondW[i] = -1.0f;
+  }
+  for(size_t op = 1; op < k_NumCubicSymOps; op++)
+  {
+    T sw = static_cast<T>(k_CubicSymW[op]);
+    T sx = static_cast<T>(k_CubicSymX[op]);
+    T sy = static_cast<T>(k_CubicSymY[op]);
+    T sz = static_cast<T>(k_CubicSymZ[op]);
+    for(size_t i = 0; i < k_BlockSize; i++)
+    {
+      T w = std::fabs(sw * qw[i] - sx * qx[i] - sy * qy[i] - sz * qz[i]);
+      bool better = w > maxW[i];
+      secondW[i] = better ? maxW[i] : (w > secondW[i] ? w : secondW[i]);
+      maxW[i] = better ? w : maxW[i];
+      bestOp[i] = better ? op : bestOp[i];
+    }
+  }
+  const T k_TieTolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+
+  for(size_t i = 0; i < count; i++)
+  {
+    size_t op = bestOp[i];
+    T sw = static_cast<T>(k_CubicSymW[op]);
+    T sx = static_cast<T>(k_CubicSymX[op]);
+    T sy = static_cast<T>(k_CubicSymY[op]);
+    T sz = static_cast<T>(k_CubicSymZ[op]);
+    T w = sw * qw[i] - sx * qx[i] - sy * qy[i] - sz * qz[i];
+    T x = sw * qx[i] + sx * qw[i] + sy * qz[i] - sz * qy[i];
+    T y = sw * qy[i] - sx * qz[i] + sy * qw[i] + sz * qx[i];
+    T z = sw * qz[i] + sx * qy[i] - sy * qx[i] + sz * qw[i];
+    if(w < 0.0f)
+    {
+      w = -w;
+      x = -x;
+      y = -y;
+      z = -z;
+    }
+
+    // axis and angle finished like the scalar disorientation so that both paths give the same colors, unless the
+    // disorientation lies on the boundary of the fundamental zone (two equivalents within rounding of each other)
+    T n = Math::Sqrt(x * x + y * y + z * z);
+    ambiguous[i] = maxW[i] - secondW[i] <= k_TieTolerance || Math::IsNearIdentity(n);
+    if(ambiguous[i])
+    {
+      continue;
+    }
+    if(n == 0.0f)
+    {
+      RodriguesVectorColor<Math>(0.0f, 0.0f, 0.0f, rgbs[i]);
+      continue;
+    }
+    T angle = 2.0f * Math::HalfAngle(n, w);
+
+    // eq c9.1
+    T k = Math::Tan(angle / 2.0f);
+    T r1 = x / n * k;
+    T r2 = y / n * k;
+    T r3 = z / n * k;
+    if(nullptr != table && table->lookup(std::fabs(r1), std::fabs(r2), std::fabs(r3), rgbs[i]))
+    {
+      continue;
+    }
+    ambiguous[i] = !RodriguesVectorColor<Math>(r1, r2, r3, rgbs[i]);
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL::Rgb CubicOpsMisoColor::generateMisorientationColor(const QuatD& q, const QuatD& refFrame) const
+{
+  QuatD q1 = q;
+  QuatD q2 = refFrame;
+
+  // get disorientation
+  OrientationD axisAngle = CubicOps::calculateMisorientation(q1, q2);
+
+  // eq c9.1
+  double k = tan(axisAngle[3] / 2.0f);
+  return ExactRodriguesVectorColor(axisAngle[0] * k, axisAngle[1] * k, axisAngle[2] * k);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const FundamentalZoneColorTable& CubicOpsMisoColor::LookupTable()
+{
+  // the fundamental zone is inside of |r_i| <= tan(pi/8), 64 intervals per axis keep the table at 3.3 MB
+  static const FundamentalZoneColorTable table({0.0, 0.0, 0.0}, {SIMPLib::Constants::k_Tan_OneEigthPiD, SIMPLib::Constants::k_Tan_OneEigthPiD, SIMPLib::Constants::k_Tan_OneEigthPiD},
+                                               {64, 64, 64}, 2, &ExactRodriguesVectorColor);
+  return table;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubicOpsMisoColor::generateMisorientationColors(const float* quats, size_t count, const QuatD& refFrame, bool useLookupTable, bool useFastMath, SIMPL::Rgb* rgbs) const
+{
+  const FundamentalZoneColorTable* table = useLookupTable ? &LookupTable() : nullptr;
+  std::array<bool, k_BlockSize> ambiguous = {};
+  if(useFastMath)
+  {
+    ColorBlock<FastColorMath>(quats, count, refFrame, table, rgbs, ambiguous);
+  }
+  else
+  {
+    ColorBlock<ExactColorMath>(quats, count, refFrame, table, rgbs, ambiguous);
+  }
+
+  // orientations on the boundary of the fundamental zone, or too close to the identity or to the branch of eq. c9.2 for
+  // single precision, are colored from EbsdLib's disorientation
+  for(size_t i = 0; i < count; i++)
+  {
+    if(ambiguous[i])
+    {
+      rgbs[i] = generateMisorientationColor(QuatD(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]), refFrame);
+    }
+  }
 }
 
 #if 0
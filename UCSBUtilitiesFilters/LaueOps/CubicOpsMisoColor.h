@@ -24,7 +24,11 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class CubicOpsMisoColor : public CubicOps
+#include "UCSBUtilities/UCSBUtilitiesDLLExport.h"
+
+class FundamentalZoneColorTable;
+
+class UCSBUtilities_EXPORT CubicOpsMisoColor final : public CubicOps
 {
 public:
   using Self = CubicOpsMisoColor;
@@ -56,6 +60,27 @@ public:
    */
   SIMPL::Rgb generateMisorientationColor(const QuatD& q, const QuatD& refFrame) const override;
 
+  static constexpr size_t k_BlockSize = 16;
+
+  /**
+   * @brief generateMisorientationColors Generates the colors of a block of orientations, searching the disorientations
+   * of the whole block together over the cubic symmetry operators. Orientations whose disorientation lies on the
+   * boundary of the fundamental zone are colored by generateMisorientationColor.
+   * @param quats count quaternions (x, y, z, w)
+   * @param count Number of orientations, at most k_BlockSize
+   * @param refFrame The reference orientation
+   * @param useLookupTable Interpolate the colors in LookupTable() instead of computing them exactly
+   * @param useFastMath Compute the disorientations and colors in single precision with approximated functions
+   * @param rgbs Output ARGB colors (count values)
+   */
+  void generateMisorientationColors(const float* quats, size_t count, const QuatD& refFrame, bool useLookupTable, bool useFastMath, SIMPL::Rgb* rgbs) const;
+
+  /**
+   * @brief LookupTable Returns the table of the misorientation colors over the magnitudes of the Rodrigues vector
+   * components of the disorientation. The table is built by the first call and kept for the lifetime of the process.
+   */
+  static const FundamentalZoneColorTable& LookupTable();
+
 public:
   CubicOpsMisoColor(const CubicOpsMisoColor&) = delete;            // Copy Constructor Not Implemented
   CubicOpsMisoColor(CubicOpsMisoColor&&) = delete;                 // Move Constructor Not Implemented
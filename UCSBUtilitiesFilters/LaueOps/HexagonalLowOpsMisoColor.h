@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class HexagonalLowOpsMisoColor : public HexagonalLowOps
+class HexagonalLowOpsMisoColor final : public HexagonalLowOps
 {
 public:
   using Self = HexagonalLowOpsMisoColor;
@@ -19,57 +19,66 @@
 
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/ColorUtilities.h"
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-HexagonalOpsMisoColor::HexagonalOpsMisoColor() = default;
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-HexagonalOpsMisoColor::~HexagonalOpsMisoColor() = default;
+#include "UCSBUtilitiesFilters/util/FundamentalZoneColorTable.h"
+#include "UCSBUtilitiesFilters/util/MisorientationColorMath.h"
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, const QuatD& refFrame) const
+namespace
 {
-  double xo, xo1, xo2, xo3, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11;
-  double yo, yo1, yo2, yo3, y, y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11;
-  double zo, zo1, zo2, zo3, z, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11;
-  double k, h, s, v;
-
-  // get misorientation as rodriguez vector in FZ
-  QuatD q1 = q;
-  QuatD q2 = refFrame;
-  OrientationD axisAngle = calculateMisorientation(q1, q2);
-  OrientationType rod = axisAngle;
-  rod[3] = tan(rod[3] / 2.0f);
-  rod = getMDFFZRod(rod);
-  xo = rod[0];
-  yo = rod[1];
-  zo = rod[2];
-  double w = rod[3];
+/**
+ * @brief Computes the misorientation color of a hexagonal disorientation from its Rodrigues vector in the fundamental
+ * zone (eq. c5.2 - c1.9) with the precision of Math
+ * @param xo, yo, zo Rotation axis
+ * @param w Length of the Rodrigues vector
+ * @return false if the disorientation is too close to the identity, or to the branch of eq. c5.2 or a sector boundary
+ * of eq. c1.6, to be colored with the precision of Math
+ */
+template <typename Math>
+bool RodriguesVectorColor(typename Math::ValueType xo, typename Math::ValueType yo, typename Math::ValueType zo, typename Math::ValueType w, SIMPL::Rgb& rgb)
+{
+  using T = typename Math::ValueType;
+  const T k_Pi = static_cast<T>(EbsdLib::Constants::k_PiD);
+  const T k_PiOver12 = static_cast<T>(M_PI / 12.0f);
+  const T k_2Pi = static_cast<T>(EbsdLib::Constants::k_2PiD);
+  const T k_Sqrt2 = static_cast<T>(EbsdLib::Constants::k_Sqrt2D);
+  const T k_Sqrt3 = static_cast<T>(EbsdLib::Constants::k_Sqrt3D);
+  const T k_HalfSqrt2 = static_cast<T>(EbsdLib::Constants::k_HalfSqrt2D);
+
+  T xo1, xo2, xo3, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11;
+  T yo1, yo2, yo3, y, y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11;
+  T zo1, zo2, zo3, z, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11;
+  T k, h, s, v;
+
+  // the Rodrigues vector is about the rotation vector of small disorientations, where the map is singular
+  if(Math::IsNearIdentity(w))
+  {
+    return false;
+  }
 
   // eq c5.2
-  k = sqrt(xo * xo + yo * yo);
+  T angle = Math::Atan2(yo, xo);
+  if(Math::IsAmbiguous(angle, k_PiOver12))
+  {
+    return false;
+  }
+  k = Math::Sqrt(xo * xo + yo * yo);
   k = (k > 0.0f) ? 1.0f / k : 1.0f;
-  k *= (atan2(yo, xo) <= M_PI / 12.0f) ? xo : (sqrt(3.0f) * xo + yo) / 2.0f;
+  k *= (angle <= k_PiOver12) ? xo : (static_cast<T>(sqrt(3.0f)) * xo + yo) / 2.0f;
   xo1 = xo * k * w;
   yo1 = yo * k * w;
-  zo1 = zo * w / (2.0f - EbsdLib::Constants::k_Sqrt3D);
+  zo1 = zo * w / (2.0f - k_Sqrt3);
 
   // eq c5.3
-  k = 3.0f * atan2(yo1, xo1);
-  xo2 = sqrt(xo1 * xo1 + yo1 * yo1);
+  k = 3.0f * Math::Atan2(yo1, xo1);
+  xo2 = Math::Sqrt(xo1 * xo1 + yo1 * yo1);
   yo2 = xo2;
-  xo2 *= cos(k);
-  yo2 *= sin(k);
+  xo2 *= Math::Cos(k);
+  yo2 *= Math::Sin(k);
   zo2 = zo1;
 
   // eq c5.4
   k = std::max(xo2, yo2);
-  k = (fabs(k) > 0) ? sqrt(xo2 * xo2 + yo2 * yo2) / k : 0.0f;
+  k = (fabs(k) > 0) ? Math::Sqrt(xo2 * xo2 + yo2 * yo2) / k : 0.0f;
   xo3 = xo2 * k;
   yo3 = yo2 * k;
   zo3 = zo2;
@@ -82,7 +91,7 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
   // eq c1.2
   k = x + y + z;
   k = (0.0f == k) ? 1.0f : 1.0f / k;
-  k *= sqrt(3.0f) * std::max(x, std::max(y, z));
+  k *= static_cast<T>(sqrt(3.0f)) * std::max(x, std::max(y, z));
   x1 = x * k;
   y1 = y * k;
   z1 = z * k;
@@ -90,37 +99,42 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
   // eq c1.3
   // 3 rotation matricies (in paper) can be multiplied into one (here) for simplicity / speed
   // g1*g2*g3 = {{sqrt(2/3), -1/sqrt(6), -1/sqrt(6)},{0, 1/sqrt(2), -1/sqrt(2)},{1/sqrt(3), 1/sqrt(3), 1/sqrt(3)}}
-  x2 = x1 * (EbsdLib::Constants::k_Sqrt2D / EbsdLib::Constants::k_Sqrt3D) - (y1 + z1) / (EbsdLib::Constants::k_Sqrt2D * EbsdLib::Constants::k_Sqrt3D);
-  y2 = (y1 - z1) / EbsdLib::Constants::k_Sqrt2D;
-  z2 = (x1 + y1 + z1) / EbsdLib::Constants::k_Sqrt3D;
+  x2 = x1 * (k_Sqrt2 / k_Sqrt3) - (y1 + z1) / (k_Sqrt2 * k_Sqrt3);
+  y2 = (y1 - z1) / k_Sqrt2;
+  z2 = (x1 + y1 + z1) / k_Sqrt3;
 
   // eq c1.4
-  k = atan2(y2, x2);
+  k = Math::Atan2(y2, x2);
   if(k < 0.0f)
   {
-    k += EbsdLib::Constants::k_2PiD;
+    k += k_2Pi;
   }
-  x3 = sqrt(x2 * x2 + y2 * y2) * sin(EbsdLib::Constants::k_PiD / 6.0f + fmod(k, EbsdLib::Constants::k_2PiD / 3.0f)) / EbsdLib::Constants::k_HalfSqrt2D;
+  x3 = Math::Sqrt(x2 * x2 + y2 * y2) * Math::Sin(k_Pi / 6.0f + Math::Fmod(k, k_2Pi / 3.0f)) / k_HalfSqrt2;
   y3 = x3;
-  x3 *= cos(k);
-  y3 *= sin(k);
+  x3 *= Math::Cos(k);
+  y3 *= Math::Sin(k);
   z3 = z2 - 1.0f;
 
   // eq c1.5
-  k = sqrt(x3 * x3 + y3 * y3 + z3 * z3);
+  k = Math::Sqrt(x3 * x3 + y3 * y3 + z3 * z3);
   k = (k > 0.0f) ? 1.0f / k : 1.0f;
-  k *= sqrt(x3 * x3 + y3 * y3) - z3;
+  k *= Math::Sqrt(x3 * x3 + y3 * y3) - z3;
   x4 = x3 * k;
   y4 = y3 * k;
   z4 = z3 * k;
 
   // eq c1.6, 7, and 8 (from matlab code not paper)
-  k = atan2(y4, x4);
+  k = Math::Atan2(y4, x4);
   if(k < 0.0f)
   {
-    k += EbsdLib::Constants::k_2PiD;
+    k += k_2Pi;
+  }
+  k *= 3.0f / k_2Pi;
+  // the sectors meet at k = 0 (== 3), 1 and 2
+  if(Math::IsAmbiguous(k, 1.0f) || Math::IsAmbiguous(k, 2.0f) || Math::IsAmbiguous(k, 3.0f) || Math::IsAmbiguous(k + 3.0f, 3.0f))
+  {
+    return false;
   }
-  k *= 3.0f / EbsdLib::Constants::k_2PiD;
   size_t type = 0;
   if(0.0f < k && k < 1.0f)
   {
@@ -138,8 +152,8 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
   switch(type)
   {
   case 1:
-    x5 = (x4 + y4 * EbsdLib::Constants::k_Sqrt3D) / 2.0f;
-    y5 = (-x4 * EbsdLib::Constants::k_Sqrt3D + y4) / 2.0f;
+    x5 = (x4 + y4 * k_Sqrt3) / 2.0f;
+    y5 = (-x4 * k_Sqrt3 + y4) / 2.0f;
     z5 = z4;
     break;
 
@@ -150,8 +164,8 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
     break;
 
   case 3:
-    x5 = (x4 - y4 * EbsdLib::Constants::k_Sqrt3D) / 2.0f;
-    y5 = (x4 * EbsdLib::Constants::k_Sqrt3D + y4) / 2.0f;
+    x5 = (x4 - y4 * k_Sqrt3) / 2.0f;
+    y5 = (x4 * k_Sqrt3 + y4) / 2.0f;
     z5 = z4;
     break;
   }
@@ -161,33 +175,33 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
   case 1: // intentional fall through
   case 2: // intentional fall through
   case 3:
-    k = 1.5f * atan2(y5, x5);
-    x6 = sqrt(x5 * x5 + y5 * y5);
+    k = 1.5f * Math::Atan2(y5, x5);
+    x6 = Math::Sqrt(x5 * x5 + y5 * y5);
     y6 = x6;
-    x6 *= cos(k);
-    y6 *= sin(k);
+    x6 *= Math::Cos(k);
+    y6 *= Math::Sin(k);
     z6 = z5;
 
-    k = 2.0f * atan2(x6, -z6);
-    x7 = sqrt(x6 * x6 + z6 * z6);
+    k = 2.0f * Math::Atan2(x6, -z6);
+    x7 = Math::Sqrt(x6 * x6 + z6 * z6);
     z7 = x7;
-    x7 *= sin(k);
+    x7 *= Math::Sin(k);
     y7 = y6;
-    z7 *= -cos(k);
+    z7 *= -Math::Cos(k);
 
-    k = (2.0f / 3.0f) * atan2(y7, x7);
-    x8 = sqrt(x7 * x7 + y7 * y7);
+    k = (2.0f / 3.0f) * Math::Atan2(y7, x7);
+    x8 = Math::Sqrt(x7 * x7 + y7 * y7);
     y8 = x8;
-    x8 *= cos(k);
-    y8 *= sin(k);
+    x8 *= Math::Cos(k);
+    y8 *= Math::Sin(k);
     z8 = z7;
   }
 
   switch(type)
   {
   case 1:
-    x9 = (x8 - y8 * EbsdLib::Constants::k_Sqrt3D) / 2.0f;
-    y9 = (x8 * EbsdLib::Constants::k_Sqrt3D + y8) / 2.0f;
+    x9 = (x8 - y8 * k_Sqrt3) / 2.0f;
+    y9 = (x8 * k_Sqrt3 + y8) / 2.0f;
     z9 = z8;
     break;
 
@@ -198,8 +212,8 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
     break;
 
   case 3:
-    x9 = (x8 + y8 * EbsdLib::Constants::k_Sqrt3D) / 2.0f;
-    y9 = (-x8 * EbsdLib::Constants::k_Sqrt3D + y8) / 2.0f;
+    x9 = (x8 + y8 * k_Sqrt3) / 2.0f;
+    y9 = (-x8 * k_Sqrt3 + y8) / 2.0f;
     z9 = z8;
     break;
 
@@ -210,37 +224,110 @@ SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, co
   }
 
   // c1.9
-  x10 = (x9 - y9 * EbsdLib::Constants::k_Sqrt3D) / 2.0f;
-  y10 = (x9 * EbsdLib::Constants::k_Sqrt3D + y9) / 2.0f;
+  x10 = (x9 - y9 * k_Sqrt3) / 2.0f;
+  y10 = (x9 * k_Sqrt3 + y9) / 2.0f;
   z10 = z9;
 
   // cartesian to traditional hsv
-  x11 = sqrt(x10 * x10 + y10 * y10 + z10 * z10); // r
-  y11 = (x11 > 0.0f) ? acos(z10 / x11) : 0.0f;   // theta
-  z11 = (x11 > 0.0f) ? atan2(y10, x10) : 0.0f;   // rho
+  x11 = Math::Sqrt(x10 * x10 + y10 * y10 + z10 * z10); // r
+  y11 = (x11 > 0.0f) ? Math::Acos(z10 / x11) : 0.0f;   // theta
+  z11 = (x11 > 0.0f) ? Math::Atan2(y10, x10) : 0.0f;   // rho
 
-  h = z11 - EbsdLib::Constants::k_2PiD / 3.0f;
+  h = z11 - k_2Pi / 3.0f;
   if(h < 0.0f)
   {
-    h += EbsdLib::Constants::k_2PiD;
+    h += k_2Pi;
   }
-  h /= EbsdLib::Constants::k_2PiD;
+  h /= k_2Pi;
 
-  if(y11 < EbsdLib::Constants::k_PiD / 2.0f)
+  if(y11 < k_Pi / 2.0f)
   {
-    s = (4.0f * x11 * y11) / (EbsdLib::Constants::k_PiD * (1 + x11));
+    s = (4.0f * x11 * y11) / (k_Pi * (1 + x11));
     v = (x11 + 1.0f) / 2.0f;
   }
   else
   { //>= pi/2
-    v = 2.0f * x11 * (0.75f - y11 / EbsdLib::Constants::k_PiD) + 0.5f;
+    v = 2.0f * x11 * (0.75f - y11 / k_Pi) + 0.5f;
     k = (v > 0.0f) ? 0.5f / v : 1.0f;
     s = 1.0f - (1.0f - x11) * k;
   }
 
   // convert to rgb and invert
-  SIMPL::Rgb rgb = EbsdLib::ColorUtilities::ConvertHSVtoRgb(h, s, v);
-  return RgbColor::dRgb(255 - RgbColor::dRed(rgb), 255 - RgbColor::dGreen(rgb), 255 - RgbColor::dBlue(rgb), 0);
+  SIMPL::Rgb hsvRgb = EbsdLib::ColorUtilities::ConvertHSVtoRgb(h, s, v);
+  rgb = RgbColor::dRgb(255 - RgbColor::dRed(hsvRgb), 255 - RgbColor::dGreen(hsvRgb), 255 - RgbColor::dBlue(hsvRgb), 0);
+  return true;
+}
+
+/**
+ * @brief Color of a node of the lookup table, the map only depends on the Rodrigues vector (axis * length)
+ */
+SIMPL::Rgb LookupTableNodeColor(double r1, double r2, double r3)
+{
+  SIMPL::Rgb rgb = 0;
+  RodriguesVectorColor<ExactColorMath>(r1, r2, r3, 1.0, rgb);
+  return rgb;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+HexagonalOpsMisoColor::HexagonalOpsMisoColor() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+HexagonalOpsMisoColor::~HexagonalOpsMisoColor() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, const QuatD& refFrame) const
+{
+  return generateMisorientationColor(q, refFrame, false, false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL::Rgb HexagonalOpsMisoColor::generateMisorientationColor(const QuatD& q, const QuatD& refFrame, bool useLookupTable, bool useFastMath) const
+{
+  // get misorientation as rodriguez vector in FZ
+  QuatD q1 = q;
+  QuatD q2 = refFrame;
+  OrientationD axisAngle = calculateMisorientation(q1, q2);
+  OrientationType rod = axisAngle;
+  rod[3] = useFastMath ? FastColorMath::Tan(static_cast<float>(rod[3]) / 2.0f) : tan(rod[3] / 2.0f);
+  rod = getMDFFZRod(rod);
+
+  SIMPL::Rgb rgb = 0;
+  if(useLookupTable && LookupTable().lookup(rod[0] * rod[3], rod[1] * rod[3], rod[2] * rod[3], rgb))
+  {
+    return rgb;
+  }
+  if(useFastMath)
+  {
+    if(RodriguesVectorColor<FastColorMath>(static_cast<float>(rod[0]), static_cast<float>(rod[1]), static_cast<float>(rod[2]), static_cast<float>(rod[3]), rgb))
+    {
+      return rgb;
+    }
+    // disorientations too close to the identity or to a branch of eq. c5.2 or c1.6 for single precision are colored
+    // exactly (the lookup table, if any, has already missed)
+    return generateMisorientationColor(q, refFrame, false, false);
+  }
+  RodriguesVectorColor<ExactColorMath>(rod[0], rod[1], rod[2], rod[3], rgb);
+  return rgb;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const FundamentalZoneColorTable& HexagonalOpsMisoColor::LookupTable()
+{
+  // the fundamental zone is inside of 0 <= x <= 1, 0 <= y <= 1/2 and 0 <= z <= 2 - sqrt(3), the intervals are about
+  // equally long in the coordinates that eq. c5.2 maps to the unit cube and keep the table at 3.3 MB
+  static const FundamentalZoneColorTable table({0.0, 0.0, 0.0}, {1.0, 0.5, 2.0 - EbsdLib::Constants::k_Sqrt3D}, {128, 64, 32}, 2, &LookupTableNodeColor);
+  return table;
 }
 
 // -----------------------------------------------------------------------------
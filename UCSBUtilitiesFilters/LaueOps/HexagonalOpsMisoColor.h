@@ -24,7 +24,9 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class HexagonalOpsMisoColor : public HexagonalOps
+class FundamentalZoneColorTable;
+
+class HexagonalOpsMisoColor final : public HexagonalOps
 {
 public:
   using Self = HexagonalOpsMisoColor;
@@ -56,6 +58,22 @@ public:
    */
   SIMPL::Rgb generateMisorientationColor(const QuatD& q, const QuatD& refFrame) const override;
 
+  /**
+   * @brief generateMisorientationColor Generates a color based on the method developed by C. Schuh and S. Patala.
+   * @param q Quaternion representing the direction
+   * @param refFrame The reference orientation
+   * @param useLookupTable Interpolate the color in LookupTable() instead of computing it exactly
+   * @param useFastMath Compute the color in single precision with approximated functions
+   * @return Returns the ARGB Quadruplet SIMPL::Rgb
+   */
+  SIMPL::Rgb generateMisorientationColor(const QuatD& q, const QuatD& refFrame, bool useLookupTable, bool useFastMath) const;
+
+  /**
+   * @brief LookupTable Returns the table of the misorientation colors over the Rodrigues vector of the disorientation
+   * in the fundamental zone. The table is built by the first call and kept for the lifetime of the process.
+   */
+  static const FundamentalZoneColorTable& LookupTable();
+
 public:
   HexagonalOpsMisoColor(const HexagonalOpsMisoColor&) = delete;            // Copy Constructor Not Implemented
   HexagonalOpsMisoColor(HexagonalOpsMisoColor&&) = delete;                 // Move Constructor Not Implemented
@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class MonoclinicOpsMisoColor : public MonoclinicOps
+class MonoclinicOpsMisoColor final : public MonoclinicOps
 {
 public:
   using Self = MonoclinicOpsMisoColor;
@@ -26,7 +26,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class OrthoRhombicOpsMisoColor : public OrthoRhombicOps
+class OrthoRhombicOpsMisoColor final : public OrthoRhombicOps
 {
 public:
   using Self = OrthoRhombicOpsMisoColor;
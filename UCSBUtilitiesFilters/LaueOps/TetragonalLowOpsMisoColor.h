@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class TetragonalLowOpsMisoColor : public TetragonalLowOps
+class TetragonalLowOpsMisoColor final : public TetragonalLowOps
 {
 public:
   using Self = TetragonalLowOpsMisoColor;
@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class TetragonalOpsMisoColor : public TetragonalOps
+class TetragonalOpsMisoColor final : public TetragonalOps
 {
 public:
   using Self = TetragonalOpsMisoColor;
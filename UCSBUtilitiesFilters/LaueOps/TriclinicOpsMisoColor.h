@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class TriclinicOpsMisoColor : public TriclinicOps
+class TriclinicOpsMisoColor final : public TriclinicOps
 {
 public:
   using Self = TriclinicOpsMisoColor;
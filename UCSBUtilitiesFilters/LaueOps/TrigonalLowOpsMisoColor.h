@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class TrigonalLowOpsMisoColor : public TrigonalLowOps
+class TrigonalLowOpsMisoColor final : public TrigonalLowOps
 {
 public:
   using Self = TrigonalLowOpsMisoColor;
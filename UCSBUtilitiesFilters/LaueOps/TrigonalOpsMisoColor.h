@@ -24,7 +24,7 @@
 
 #include "SIMPLib/Utilities/ColorTable.h"
 
-class TrigonalOpsMisoColor : public TrigonalOps
+class TrigonalOpsMisoColor final : public TrigonalOps
 {
 public:
   using Self = TrigonalOpsMisoColor;
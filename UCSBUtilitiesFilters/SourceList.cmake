@@ -73,6 +73,9 @@ foreach(f ${_PrivateFilters} )
 endforeach()
 
 ADD_SIMPL_SUPPORT_CLASS(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} util/UCSBHelpers)
+ADD_SIMPL_SUPPORT_HEADER(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} util/DirectionalModulusKernels.h)
+ADD_SIMPL_SUPPORT_HEADER(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} util/FundamentalZoneColorTable.h)
+ADD_SIMPL_SUPPORT_HEADER(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} util/MisorientationColorMath.h)
 ADD_SIMPL_SUPPORT_CLASS(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} LaueOps/CubicLowOpsMisoColor)
 ADD_SIMPL_SUPPORT_CLASS(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} LaueOps/CubicOpsMisoColor)
 ADD_SIMPL_SUPPORT_CLASS(${UCSBUtilities_SOURCE_DIR} ${_filterGroupName} LaueOps/HexagonalLowOpsMisoColor)
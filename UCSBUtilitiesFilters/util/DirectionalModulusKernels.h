@@ -0,0 +1,795 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                               *
+ * Copyright (c) 2015 The Regents of the University of California, Author: William Lenthe        *
+ *                                                                                               *
+ * This program is free software: you can redistribute it and/or modify it under the terms of    *
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either    *
+ * version 2 of the License, or (at your option) any later version.                              *
+ *                                                                                               *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;     *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.     *
+ * See the GNU Lesser General Public License for more details.                                   *
+ *                                                                                               *
+ * You should have received a copy of the GNU Lesser General Public License                      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.                         *
+ *                                                                                               *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+/**
+ * @brief Structure-of-arrays kernels for evaluating directional elastic moduli (1/s'11 of a rotated compliance matrix).
+ * Orientations are processed in blocks of k_BlockSize features stored as separate x, y, z, w (and a, b, c) arrays so
+ * that each loop body is a straight line of arithmetic the compiler can vectorize for the target instruction set.
+ */
+namespace DirectionalModulusKernels
+{
+/**
+ * @brief Number of features evaluated together by the block kernels
+ */
+constexpr size_t k_BlockSize = 16;
+
+/**
+ * @brief Symmetry of a single crystal compliance matrix, determines which of the 21 terms of s'11 can be non zero
+ */
+enum class ElasticSymmetry
+{
+  Cubic,                 //!< m-3m, m-3 (S11 = S22 = S33, S12 = S13 = S23, S44 = S55 = S66)
+  TransverselyIsotropic, //!< 6/mmm, 6/m (isotropic in the basal plane)
+  Orthotropic,           //!< mmm, 4/mmm (only the diagonal blocks are non zero)
+  General                //!< all other Laue classes (full 21 term expression)
+};
+
+/**
+ * @brief Determines which terms of s'11 a phase can have from its Laue class
+ * @param crystalStructure Crystal structure of the phase
+ * @return Symmetry of the phase's compliance matrix
+ */
+inline ElasticSymmetry FindElasticSymmetry(unsigned int crystalStructure)
+{
+  switch(crystalStructure)
+  {
+  case EbsdLib::CrystalStructure::Cubic_High:
+  case EbsdLib::CrystalStructure::Cubic_Low:
+    return ElasticSymmetry::Cubic;
+  case EbsdLib::CrystalStructure::Hexagonal_High:
+  case EbsdLib::CrystalStructure::Hexagonal_Low:
+    return ElasticSymmetry::TransverselyIsotropic;
+  case EbsdLib::CrystalStructure::OrthoRhombic:
+  case EbsdLib::CrystalStructure::Tetragonal_High:
+    return ElasticSymmetry::Orthotropic;
+  default:
+    return ElasticSymmetry::General;
+  }
+}
+
+/**
+ * @brief Linear map L (row major 4x4) such that the quaternion product q2 q1 == L q1 for a fixed q2
+ */
+using QuaternionProductMatrix = std::array<float, 16>;
+
+/**
+ * @brief The ComplianceCoefficients struct holds the 21 independent single crystal compliances of a phase with the
+ * multiplicity of each term in s'11 (1 for diagonal, 2 for off diagonal) already folded in
+ */
+struct ComplianceCoefficients
+{
+  float s11 = 0.0f;
+  float s12 = 0.0f;
+  float s13 = 0.0f;
+  float s14 = 0.0f;
+  float s15 = 0.0f;
+  float s16 = 0.0f;
+  float s22 = 0.0f;
+  float s23 = 0.0f;
+  float s24 = 0.0f;
+  float s25 = 0.0f;
+  float s26 = 0.0f;
+  float s33 = 0.0f;
+  float s34 = 0.0f;
+  float s35 = 0.0f;
+  float s36 = 0.0f;
+  float s44 = 0.0f;
+  float s45 = 0.0f;
+  float s46 = 0.0f;
+  float s55 = 0.0f;
+  float s56 = 0.0f;
+  float s66 = 0.0f;
+
+  /**
+   * @brief Builds the coefficients from a 6x6 (row major) compliance matrix
+   * @param compliances 6x6 single crystal compliance matrix
+   * @return Coefficients
+   */
+  static ComplianceCoefficients FromCompliances(const float* compliances)
+  {
+    ComplianceCoefficients s;
+    s.s11 = compliances[0];
+    s.s12 = 2.0f * compliances[1];
+    s.s13 = 2.0f * compliances[2];
+    s.s14 = 2.0f * compliances[3];
+    s.s15 = 2.0f * compliances[4];
+    s.s16 = 2.0f * compliances[5];
+    s.s22 = compliances[7];
+    s.s23 = 2.0f * compliances[8];
+    s.s24 = 2.0f * compliances[9];
+    s.s25 = 2.0f * compliances[10];
+    s.s26 = 2.0f * compliances[11];
+    s.s33 = compliances[14];
+    s.s34 = 2.0f * compliances[15];
+    s.s35 = 2.0f * compliances[16];
+    s.s36 = 2.0f * compliances[17];
+    s.s44 = compliances[21];
+    s.s45 = 2.0f * compliances[22];
+    s.s46 = 2.0f * compliances[23];
+    s.s55 = compliances[28];
+    s.s56 = 2.0f * compliances[29];
+    s.s66 = compliances[35];
+    return s;
+  }
+};
+
+/**
+ * @brief Rotates a block of crystal orientations by a fixed loading rotation and returns the loading direction in the
+ * crystal frame of each orientation
+ * @param qx x component of each orientation
+ * @param qy y component of each orientation
+ * @param qz z component of each orientation
+ * @param qw w component of each orientation
+ * @param count Number of orientations (at most k_BlockSize)
+ * @param rotation Product matrix of the loading rotation
+ * @param a Output: x component of the loading direction in the crystal frame
+ * @param b Output: y component of the loading direction in the crystal frame
+ * @param c Output: z component of the loading direction in the crystal frame
+ */
+inline void CrystalDirections(const float* qx, const float* qy, const float* qz, const float* qw, size_t count, const QuaternionProductMatrix& rotation, float* a, float* b, float* c)
+{
+  // local copies so the compiler knows the rotation and the results can't alias the orientations (otherwise the three
+  // outputs need more run time alias checks than the vectorizer is willing to emit)
+  const QuaternionProductMatrix r = rotation;
+  std::array<float, k_BlockSize> blockA;
+  std::array<float, k_BlockSize> blockB;
+  std::array<float, k_BlockSize> blockC;
+
+  // s'11 of the rotated compliance only depends on the first row of the rotation matrix (Bower, Applied Mechanics of Solids, pg. 80)
+  for(size_t i = 0; i < count; i++)
+  {
+    // qTotal = q2 q1
+    float x = r[0] * qx[i] + r[1] * qy[i] + r[2] * qz[i] + r[3] * qw[i];
+    float y = r[4] * qx[i] + r[5] * qy[i] + r[6] * qz[i] + r[7] * qw[i];
+    float z = r[8] * qx[i] + r[9] * qy[i] + r[10] * qz[i] + r[11] * qw[i];
+    float w = r[12] * qx[i] + r[13] * qy[i] + r[14] * qz[i] + r[15] * qw[i];
+
+    blockA[i] = 1.0f - 2.0f * (y * y + z * z);
+    blockB[i] = 2.0f * (x * y - z * w);
+    blockC[i] = 2.0f * (x * z + y * w);
+  }
+  std::copy(blockA.begin(), blockA.begin() + count, a);
+  std::copy(blockB.begin(), blockB.begin() + count, b);
+  std::copy(blockC.begin(), blockC.begin() + count, c);
+}
+
+/**
+ * @brief Computes the directional modulus for a block of crystal frame loading directions. Each specialization only
+ * evaluates the terms of s'11 that can be non zero for its symmetry, the compliances are assumed to respect that symmetry.
+ * @param a x component of the loading direction in the crystal frame (unit length direction)
+ * @param b y component of the loading direction in the crystal frame
+ * @param c z component of the loading direction in the crystal frame
+ * @param count Number of directions (at most k_BlockSize)
+ * @param s Compliance coefficients of the phase
+ * @param moduli Output: directional modulus for each direction
+ */
+template <ElasticSymmetry Symmetry>
+void Moduli(const float* a, const float* b, const float* c, size_t count, const ComplianceCoefficients& s, float* moduli);
+
+/**
+ * @brief Cubic: s'11 = S11 - 2 (S11 - S12 - S44 / 2) (a^2 b^2 + b^2 c^2 + c^2 a^2)
+ */
+template <>
+inline void Moduli<ElasticSymmetry::Cubic>(const float* a, const float* b, const float* c, size_t count, const ComplianceCoefficients& s, float* moduli)
+{
+  // s.s12 already holds 2 S12
+  const float s11 = s.s11;
+  const float anisotropy = 2.0f * s11 - s.s12 - s.s44;
+  for(size_t i = 0; i < count; i++)
+  {
+    float a2 = a[i] * a[i];
+    float b2 = b[i] * b[i];
+    float c2 = c[i] * c[i];
+    float s11prime = s11 - anisotropy * (a2 * b2 + b2 * c2 + c2 * a2);
+    moduli[i] = 1.0f / s11prime;
+  }
+}
+
+/**
+ * @brief Transversely isotropic (c axis): s'11 = S11 (1 - c^2)^2 + S33 c^4 + (2 S13 + S44) c^2 (1 - c^2)
+ */
+template <>
+inline void Moduli<ElasticSymmetry::TransverselyIsotropic>(const float* a, const float* b, const float* c, size_t count, const ComplianceCoefficients& s, float* moduli)
+{
+  (void)a;
+  (void)b;
+  const float mixed = s.s13 + s.s44;
+  for(size_t i = 0; i < count; i++)
+  {
+    float c2 = c[i] * c[i];
+    float basal = 1.0f - c2;
+    float s11prime = s.s11 * basal * basal + s.s33 * c2 * c2 + mixed * c2 * basal;
+    moduli[i] = 1.0f / s11prime;
+  }
+}
+
+/**
+ * @brief Orthotropic: s'11 = S11 a^4 + S22 b^4 + S33 c^4 + (2 S12 + S66) a^2 b^2 + (2 S13 + S55) a^2 c^2 + (2 S23 + S44) b^2 c^2
+ */
+template <>
+inline void Moduli<ElasticSymmetry::Orthotropic>(const float* a, const float* b, const float* c, size_t count, const ComplianceCoefficients& s, float* moduli)
+{
+  const float ab = s.s12 + s.s66;
+  const float ac = s.s13 + s.s55;
+  const float bc = s.s23 + s.s44;
+  for(size_t i = 0; i < count; i++)
+  {
+    float a2 = a[i] * a[i];
+    float b2 = b[i] * b[i];
+    float c2 = c[i] * c[i];
+    float s11prime = s.s11 * a2 * a2 + s.s22 * b2 * b2 + s.s33 * c2 * c2 + ab * a2 * b2 + ac * a2 * c2 + bc * b2 * c2;
+    moduli[i] = 1.0f / s11prime;
+  }
+}
+
+/**
+ * @brief General (triclinic): all 21 terms
+ */
+template <>
+inline void Moduli<ElasticSymmetry::General>(const float* a, const float* b, const float* c, size_t count, const ComplianceCoefficients& s, float* moduli)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    // squares are used extensively, compute once
+    float a2 = a[i] * a[i];
+    float b2 = b[i] * b[i];
+    float c2 = c[i] * c[i];
+    float ab = a[i] * b[i];
+    float ac = a[i] * c[i];
+    float bc = b[i] * c[i];
+
+    // rotated compliance weightings (a^4, b^4, c^4, b^2 c^2, a^2 c^2, a^2 b^2 ...) times the compliances
+    float s11prime = s.s11 * a2 * a2 + s.s12 * a2 * b2 + s.s13 * a2 * c2 + s.s14 * a2 * bc + s.s15 * a2 * ac + s.s16 * a2 * ab +
+
+                     s.s22 * b2 * b2 + s.s23 * b2 * c2 + s.s24 * b2 * bc + s.s25 * b2 * ac + s.s26 * b2 * ab +
+
+                     s.s33 * c2 * c2 + s.s34 * c2 * bc + s.s35 * c2 * ac + s.s36 * c2 * ab +
+
+                     s.s44 * b2 * c2 + s.s45 * c2 * ab + s.s46 * b2 * ac +
+
+                     s.s55 * a2 * c2 + s.s56 * a2 * bc +
+
+                     s.s66 * a2 * b2;
+
+    // compute modulus
+    moduli[i] = 1.0f / s11prime;
+  }
+}
+
+/**
+ * @brief Computes the directional modulus for a block of crystal frame loading directions with the kernel for a symmetry
+ * @param symmetry Symmetry of the phase's compliance matrix
+ * @param a x component of the loading direction in the crystal frame (unit length direction)
+ * @param b y component of the loading direction in the crystal frame
+ * @param c z component of the loading direction in the crystal frame
+ * @param count Number of directions (at most k_BlockSize)
+ * @param s Compliance coefficients of the phase
+ * @param moduli Output: directional modulus for each direction
+ */
+inline void SymmetryModuli(ElasticSymmetry symmetry, const float* a, const float* b, const float* c, size_t count, const ComplianceCoefficients& s, float* moduli)
+{
+  switch(symmetry)
+  {
+  case ElasticSymmetry::Cubic:
+    Moduli<ElasticSymmetry::Cubic>(a, b, c, count, s, moduli);
+    break;
+  case ElasticSymmetry::TransverselyIsotropic:
+    Moduli<ElasticSymmetry::TransverselyIsotropic>(a, b, c, count, s, moduli);
+    break;
+  case ElasticSymmetry::Orthotropic:
+    Moduli<ElasticSymmetry::Orthotropic>(a, b, c, count, s, moduli);
+    break;
+  case ElasticSymmetry::General:
+    Moduli<ElasticSymmetry::General>(a, b, c, count, s, moduli);
+    break;
+  }
+}
+
+/**
+ * @brief Rotates a crystal frame direction into the sample frame of a block of crystal orientations (d = g v, the rows
+ * of the orientation matrix g are the sample axes in the crystal frame)
+ * @param qx x component of each orientation
+ * @param qy y component of each orientation
+ * @param qz z component of each orientation
+ * @param qw w component of each orientation
+ * @param count Number of orientations (at most k_BlockSize)
+ * @param v Direction in the crystal frame
+ * @param x Output: x component of the direction in the sample frame
+ * @param y Output: y component of the direction in the sample frame
+ * @param z Output: z component of the direction in the sample frame
+ */
+inline void SampleDirections(const float* qx, const float* qy, const float* qz, const float* qw, size_t count, const std::array<float, 3>& v, float* x, float* y, float* z)
+{
+  // local copies for the same reason as in CrystalDirections
+  const float v0 = v[0];
+  const float v1 = v[1];
+  const float v2 = v[2];
+  std::array<float, k_BlockSize> blockX;
+  std::array<float, k_BlockSize> blockY;
+  std::array<float, k_BlockSize> blockZ;
+  for(size_t i = 0; i < count; i++)
+  {
+    float qxx = qx[i] * qx[i];
+    float qyy = qy[i] * qy[i];
+    float qzz = qz[i] * qz[i];
+    float qxy = qx[i] * qy[i];
+    float qxz = qx[i] * qz[i];
+    float qyz = qy[i] * qz[i];
+    float qxw = qx[i] * qw[i];
+    float qyw = qy[i] * qw[i];
+    float qzw = qz[i] * qw[i];
+    blockX[i] = (1.0f - 2.0f * (qyy + qzz)) * v0 + 2.0f * (qxy - qzw) * v1 + 2.0f * (qxz + qyw) * v2;
+    blockY[i] = 2.0f * (qxy + qzw) * v0 + (1.0f - 2.0f * (qxx + qzz)) * v1 + 2.0f * (qyz - qxw) * v2;
+    blockZ[i] = 2.0f * (qxz - qyw) * v0 + 2.0f * (qyz + qxw) * v1 + (1.0f - 2.0f * (qxx + qyy)) * v2;
+  }
+  std::copy(blockX.begin(), blockX.begin() + count, x);
+  std::copy(blockY.begin(), blockY.begin() + count, y);
+  std::copy(blockZ.begin(), blockZ.begin() + count, z);
+}
+
+/**
+ * @brief Rotates a sample frame direction per orientation into the crystal frame of a block of crystal orientations
+ * (u = g^T d, the inverse of SampleDirections)
+ * @param qx x component of each orientation
+ * @param qy y component of each orientation
+ * @param qz z component of each orientation
+ * @param qw w component of each orientation
+ * @param count Number of orientations (at most k_BlockSize)
+ * @param x x component of each direction in the sample frame
+ * @param y y component of each direction in the sample frame
+ * @param z z component of each direction in the sample frame
+ * @param a Output: x component of each direction in the crystal frame
+ * @param b Output: y component of each direction in the crystal frame
+ * @param c Output: z component of each direction in the crystal frame
+ */
+inline void CrystalFrameDirections(const float* qx, const float* qy, const float* qz, const float* qw, size_t count, const float* x, const float* y, const float* z, float* a, float* b,
+                                   float* c)
+{
+  // local results for the same reason as in CrystalDirections
+  std::array<float, k_BlockSize> blockA;
+  std::array<float, k_BlockSize> blockB;
+  std::array<float, k_BlockSize> blockC;
+  for(size_t i = 0; i < count; i++)
+  {
+    float qxx = qx[i] * qx[i];
+    float qyy = qy[i] * qy[i];
+    float qzz = qz[i] * qz[i];
+    float qxy = qx[i] * qy[i];
+    float qxz = qx[i] * qz[i];
+    float qyz = qy[i] * qz[i];
+    float qxw = qx[i] * qw[i];
+    float qyw = qy[i] * qw[i];
+    float qzw = qz[i] * qw[i];
+    blockA[i] = (1.0f - 2.0f * (qyy + qzz)) * x[i] + 2.0f * (qxy + qzw) * y[i] + 2.0f * (qxz - qyw) * z[i];
+    blockB[i] = 2.0f * (qxy - qzw) * x[i] + (1.0f - 2.0f * (qxx + qzz)) * y[i] + 2.0f * (qyz + qxw) * z[i];
+    blockC[i] = 2.0f * (qxz + qyw) * x[i] + 2.0f * (qyz - qxw) * y[i] + (1.0f - 2.0f * (qxx + qyy)) * z[i];
+  }
+  std::copy(blockA.begin(), blockA.begin() + count, a);
+  std::copy(blockB.begin(), blockB.begin() + count, b);
+  std::copy(blockC.begin(), blockC.begin() + count, c);
+}
+
+/**
+ * @brief The ExtremalModuli struct holds the smallest and largest directional modulus of a phase and the crystal frame
+ * directions they occur along. Since the set of moduli over all directions doesn't depend on the orientation these are
+ * found once per phase, the sample frame directions of each orientation then follow from SampleDirections.
+ */
+struct ExtremalModuli
+{
+  float minModulus = 0.0f;
+  float maxModulus = 0.0f;
+  std::array<float, 3> minDirection = {1.0f, 0.0f, 0.0f};
+  std::array<float, 3> maxDirection = {1.0f, 0.0f, 0.0f};
+};
+
+/**
+ * @brief Refines an extremum of the directional modulus by a pattern search on the unit sphere
+ * @param symmetry Symmetry of the phase's compliance matrix
+ * @param s Compliance coefficients of the phase
+ * @param direction Starting direction (unit length)
+ * @param step Initial step (radians)
+ * @param sign 1 to search for a maximum, -1 for a minimum
+ * @return Refined direction
+ */
+inline std::array<float, 3> RefineExtremalDirection(ElasticSymmetry symmetry, const ComplianceCoefficients& s, std::array<float, 3> direction, float step, float sign)
+{
+  const float k_MinStep = 1.0e-4f;
+  const size_t k_MaxIterations = 1000;
+
+  float best = 0.0f;
+  SymmetryModuli(symmetry, &direction[0], &direction[1], &direction[2], 1, s, &best);
+  best *= sign;
+  for(size_t iteration = 0; iteration < k_MaxIterations && step > k_MinStep; iteration++)
+  {
+    // tangent plane basis (crossed with the axis the direction is furthest from)
+    std::array<float, 3> axis = {0.0f, 0.0f, 0.0f};
+    size_t smallest = std::fabs(direction[0]) < std::fabs(direction[1]) ? 0 : 1;
+    smallest = std::fabs(direction[smallest]) < std::fabs(direction[2]) ? smallest : 2;
+    axis[smallest] = 1.0f;
+    std::array<float, 3> t1 = {direction[1] * axis[2] - direction[2] * axis[1], direction[2] * axis[0] - direction[0] * axis[2], direction[0] * axis[1] - direction[1] * axis[0]};
+    float t1Norm = 1.0f / std::sqrt(t1[0] * t1[0] + t1[1] * t1[1] + t1[2] * t1[2]);
+    for(float& t : t1)
+    {
+      t *= t1Norm;
+    }
+    std::array<float, 3> t2 = {direction[1] * t1[2] - direction[2] * t1[1], direction[2] * t1[0] - direction[0] * t1[2], direction[0] * t1[1] - direction[1] * t1[0]};
+
+    // evaluate the 4 neighbors
+    std::array<float, 4> a;
+    std::array<float, 4> b;
+    std::array<float, 4> c;
+    std::array<float, 4> moduli;
+    const float offsets[4][2] = {{step, 0.0f}, {-step, 0.0f}, {0.0f, step}, {0.0f, -step}};
+    for(size_t n = 0; n < 4; n++)
+    {
+      float dx = direction[0] + offsets[n][0] * t1[0] + offsets[n][1] * t2[0];
+      float dy = direction[1] + offsets[n][0] * t1[1] + offsets[n][1] * t2[1];
+      float dz = direction[2] + offsets[n][0] * t1[2] + offsets[n][1] * t2[2];
+      float norm = 1.0f / std::sqrt(dx * dx + dy * dy + dz * dz);
+      a[n] = dx * norm;
+      b[n] = dy * norm;
+      c[n] = dz * norm;
+    }
+    SymmetryModuli(symmetry, a.data(), b.data(), c.data(), 4, s, moduli.data());
+
+    // move to the best improving neighbor or shrink the step
+    size_t bestNeighbor = 4;
+    for(size_t n = 0; n < 4; n++)
+    {
+      if(sign * moduli[n] > best)
+      {
+        best = sign * moduli[n];
+        bestNeighbor = n;
+      }
+    }
+    if(bestNeighbor < 4)
+    {
+      direction = {a[bestNeighbor], b[bestNeighbor], c[bestNeighbor]};
+    }
+    else
+    {
+      step *= 0.5f;
+    }
+  }
+  return direction;
+}
+
+/**
+ * @brief Finds the extremal directional moduli of a phase. Cubic and transversely isotropic phases have closed form
+ * stationary points (<100> / <111> and the c axis angle where d s'11 / d c^2 = 0), all other phases are searched
+ * coarse to fine: the upper hemisphere is sampled on a stereographic grid and the best few samples are refined.
+ * @param symmetry Symmetry of the phase's compliance matrix
+ * @param s Compliance coefficients of the phase
+ * @return Extremal moduli and their crystal frame directions
+ */
+inline ExtremalModuli FindExtremalModuli(ElasticSymmetry symmetry, const ComplianceCoefficients& s)
+{
+  ExtremalModuli extremal;
+  if(ElasticSymmetry::Cubic == symmetry)
+  {
+    // s'11 is linear in a^2 b^2 + b^2 c^2 + c^2 a^2 which ranges from 0 (<100>) to 1/3 (<111>)
+    const float k_InvSqrt3 = 1.0f / std::sqrt(3.0f);
+    float modulus100 = 1.0f / s.s11;
+    float modulus111 = 1.0f / (s.s11 - (2.0f * s.s11 - s.s12 - s.s44) / 3.0f);
+    std::array<float, 3> direction100 = {1.0f, 0.0f, 0.0f};
+    std::array<float, 3> direction111 = {k_InvSqrt3, k_InvSqrt3, k_InvSqrt3};
+    bool stiff111 = modulus111 > modulus100;
+    extremal.minModulus = stiff111 ? modulus100 : modulus111;
+    extremal.maxModulus = stiff111 ? modulus111 : modulus100;
+    extremal.minDirection = stiff111 ? direction100 : direction111;
+    extremal.maxDirection = stiff111 ? direction111 : direction100;
+    return extremal;
+  }
+
+  if(ElasticSymmetry::TransverselyIsotropic == symmetry)
+  {
+    // s'11 is quadratic in t = c^2, check the ends (basal plane, c axis) and the stationary point
+    const float mixed = s.s13 + s.s44;
+    std::array<float, 3> candidates = {0.0f, 1.0f, -1.0f};
+    float curvature = s.s11 + s.s33 - mixed;
+    if(curvature != 0.0f)
+    {
+      float t = (2.0f * s.s11 - mixed) / (2.0f * curvature);
+      candidates[2] = (t > 0.0f && t < 1.0f) ? t : -1.0f;
+    }
+    bool first = true;
+    for(float t : candidates)
+    {
+      if(t < 0.0f)
+      {
+        continue;
+      }
+      std::array<float, 3> direction = {std::sqrt(1.0f - t), 0.0f, std::sqrt(t)};
+      float modulus = 1.0f / (s.s11 * (1.0f - t) * (1.0f - t) + s.s33 * t * t + mixed * t * (1.0f - t));
+      if(first || modulus < extremal.minModulus)
+      {
+        extremal.minModulus = modulus;
+        extremal.minDirection = direction;
+      }
+      if(first || modulus > extremal.maxModulus)
+      {
+        extremal.maxModulus = modulus;
+        extremal.maxDirection = direction;
+      }
+      first = false;
+    }
+    return extremal;
+  }
+
+  // coarse search over the stereographic projection of the upper hemisphere
+  const size_t k_CoarseResolution = 33;
+  const size_t k_NumCandidates = 4;
+  const float spacing = 2.0f / static_cast<float>(k_CoarseResolution - 1);
+  std::vector<std::pair<float, std::array<float, 3>>> samples;
+  samples.reserve(k_CoarseResolution * k_CoarseResolution);
+  for(size_t j = 0; j < k_CoarseResolution; j++)
+  {
+    float y = static_cast<float>(j) * spacing - 1.0f;
+    for(size_t i = 0; i < k_CoarseResolution; i++)
+    {
+      float x = static_cast<float>(i) * spacing - 1.0f;
+      float r2 = x * x + y * y;
+      if(r2 > 1.0f)
+      {
+        continue;
+      }
+      float denom = 1.0f / (1.0f + r2);
+      std::array<float, 3> direction = {2.0f * x * denom, 2.0f * y * denom, (1.0f - r2) * denom};
+      float modulus = 0.0f;
+      SymmetryModuli(symmetry, &direction[0], &direction[1], &direction[2], 1, s, &modulus);
+      samples.emplace_back(modulus, direction);
+    }
+  }
+  auto byModulus = [](const std::pair<float, std::array<float, 3>>& lhs, const std::pair<float, std::array<float, 3>>& rhs) { return lhs.first < rhs.first; };
+  std::sort(samples.begin(), samples.end(), byModulus);
+
+  // refine the best few candidates for each extremum (starting from a step of about one grid spacing)
+  bool first = true;
+  for(size_t n = 0; n < k_NumCandidates && n < samples.size(); n++)
+  {
+    std::array<float, 3> minDirection = RefineExtremalDirection(symmetry, s, samples[n].second, spacing, -1.0f);
+    std::array<float, 3> maxDirection = RefineExtremalDirection(symmetry, s, samples[samples.size() - 1 - n].second, spacing, 1.0f);
+    float minModulus = 0.0f;
+    float maxModulus = 0.0f;
+    SymmetryModuli(symmetry, &minDirection[0], &minDirection[1], &minDirection[2], 1, s, &minModulus);
+    SymmetryModuli(symmetry, &maxDirection[0], &maxDirection[1], &maxDirection[2], 1, s, &maxModulus);
+    if(first || minModulus < extremal.minModulus)
+    {
+      extremal.minModulus = minModulus;
+      extremal.minDirection = minDirection;
+    }
+    if(first || maxModulus > extremal.maxModulus)
+    {
+      extremal.maxModulus = maxModulus;
+      extremal.maxDirection = maxDirection;
+    }
+    first = false;
+  }
+  return extremal;
+}
+
+/**
+ * @brief Number of independent components of a compliance matrix (upper triangle, row major: S11, S12 ... S16, S22 ... S66)
+ */
+constexpr size_t k_NumCompliances = 21;
+
+/**
+ * @brief Block of rotated compliances, component major (sampleCompliances[k][i] is component k of orientation i)
+ */
+using ComplianceBlock = std::array<std::array<float, k_BlockSize>, k_NumCompliances>;
+
+/**
+ * @brief Rotates a compliance matrix into the sample frame of a block of crystal orientations. The rows of the
+ * orientation matrix g are the sample axes in the crystal frame so the (engineering strain) Voigt transformation T is
+ * built directly from products of g and S' = T S T^T is expanded in closed form (instead of inverting a 6x6 stiffness
+ * rotation matrix per orientation). Every term is written out so that the loop over orientations vectorizes.
+ * @param qx x component of each orientation
+ * @param qy y component of each orientation
+ * @param qz z component of each orientation
+ * @param qw w component of each orientation
+ * @param count Number of orientations (at most k_BlockSize)
+ * @param compliances 6x6 single crystal compliance matrix
+ * @param sampleCompliances Output: the 21 independent sample frame compliances of each orientation
+ */
+inline void SampleCompliances(const float* qx, const float* qy, const float* qz, const float* qw, size_t count, const float* compliances, ComplianceBlock& sampleCompliances)
+{
+  // local copy so the compiler knows the compliances can't alias the output
+  std::array<float, 36> s;
+  std::copy(compliances, compliances + 36, s.begin());
+
+  for(size_t i = 0; i < count; i++)
+  {
+    float x = qx[i];
+    float y = qy[i];
+    float z = qz[i];
+    float w = qw[i];
+
+    // orientation matrix
+    float g00 = 1.0f - 2.0f * (y * y + z * z);
+    float g01 = 2.0f * (x * y - z * w);
+    float g02 = 2.0f * (x * z + y * w);
+    float g10 = 2.0f * (x * y + z * w);
+    float g11 = 1.0f - 2.0f * (x * x + z * z);
+    float g12 = 2.0f * (y * z - x * w);
+    float g20 = 2.0f * (x * z - y * w);
+    float g21 = 2.0f * (y * z + x * w);
+    float g22 = 1.0f - 2.0f * (x * x + y * y);
+
+    // strain transformation matrix (Voigt order 11, 22, 33, 23, 13, 12)
+    // normal rows: g_ip g_iq
+    float t00 = g00 * g00, t01 = g01 * g01, t02 = g02 * g02, t03 = g01 * g02, t04 = g00 * g02, t05 = g00 * g01;
+    float t10 = g10 * g10, t11 = g11 * g11, t12 = g12 * g12, t13 = g11 * g12, t14 = g10 * g12, t15 = g10 * g11;
+    float t20 = g20 * g20, t21 = g21 * g21, t22 = g22 * g22, t23 = g21 * g22, t24 = g20 * g22, t25 = g20 * g21;
+    // shear rows: 2 g_ip g_jp (normal columns), g_ip g_jq + g_iq g_jp (shear columns)
+    float t30 = 2.0f * g10 * g20, t31 = 2.0f * g11 * g21, t32 = 2.0f * g12 * g22;
+    float t33 = g11 * g22 + g12 * g21, t34 = g10 * g22 + g12 * g20, t35 = g10 * g21 + g11 * g20;
+    float t40 = 2.0f * g00 * g20, t41 = 2.0f * g01 * g21, t42 = 2.0f * g02 * g22;
+    float t43 = g01 * g22 + g02 * g21, t44 = g00 * g22 + g02 * g20, t45 = g00 * g21 + g01 * g20;
+    float t50 = 2.0f * g00 * g10, t51 = 2.0f * g01 * g11, t52 = 2.0f * g02 * g12;
+    float t53 = g01 * g12 + g02 * g11, t54 = g00 * g12 + g02 * g10, t55 = g00 * g11 + g01 * g10;
+
+    // W = S T^T
+    float w00 = s[0] * t00 + s[1] * t01 + s[2] * t02 + s[3] * t03 + s[4] * t04 + s[5] * t05;
+    float w01 = s[0] * t10 + s[1] * t11 + s[2] * t12 + s[3] * t13 + s[4] * t14 + s[5] * t15;
+    float w02 = s[0] * t20 + s[1] * t21 + s[2] * t22 + s[3] * t23 + s[4] * t24 + s[5] * t25;
+    float w03 = s[0] * t30 + s[1] * t31 + s[2] * t32 + s[3] * t33 + s[4] * t34 + s[5] * t35;
+    float w04 = s[0] * t40 + s[1] * t41 + s[2] * t42 + s[3] * t43 + s[4] * t44 + s[5] * t45;
+    float w05 = s[0] * t50 + s[1] * t51 + s[2] * t52 + s[3] * t53 + s[4] * t54 + s[5] * t55;
+    float w10 = s[6] * t00 + s[7] * t01 + s[8] * t02 + s[9] * t03 + s[10] * t04 + s[11] * t05;
+    float w11 = s[6] * t10 + s[7] * t11 + s[8] * t12 + s[9] * t13 + s[10] * t14 + s[11] * t15;
+    float w12 = s[6] * t20 + s[7] * t21 + s[8] * t22 + s[9] * t23 + s[10] * t24 + s[11] * t25;
+    float w13 = s[6] * t30 + s[7] * t31 + s[8] * t32 + s[9] * t33 + s[10] * t34 + s[11] * t35;
+    float w14 = s[6] * t40 + s[7] * t41 + s[8] * t42 + s[9] * t43 + s[10] * t44 + s[11] * t45;
+    float w15 = s[6] * t50 + s[7] * t51 + s[8] * t52 + s[9] * t53 + s[10] * t54 + s[11] * t55;
+    float w20 = s[12] * t00 + s[13] * t01 + s[14] * t02 + s[15] * t03 + s[16] * t04 + s[17] * t05;
+    float w21 = s[12] * t10 + s[13] * t11 + s[14] * t12 + s[15] * t13 + s[16] * t14 + s[17] * t15;
+    float w22 = s[12] * t20 + s[13] * t21 + s[14] * t22 + s[15] * t23 + s[16] * t24 + s[17] * t25;
+    float w23 = s[12] * t30 + s[13] * t31 + s[14] * t32 + s[15] * t33 + s[16] * t34 + s[17] * t35;
+    float w24 = s[12] * t40 + s[13] * t41 + s[14] * t42 + s[15] * t43 + s[16] * t44 + s[17] * t45;
+    float w25 = s[12] * t50 + s[13] * t51 + s[14] * t52 + s[15] * t53 + s[16] * t54 + s[17] * t55;
+    float w30 = s[18] * t00 + s[19] * t01 + s[20] * t02 + s[21] * t03 + s[22] * t04 + s[23] * t05;
+    float w31 = s[18] * t10 + s[19] * t11 + s[20] * t12 + s[21] * t13 + s[22] * t14 + s[23] * t15;
+    float w32 = s[18] * t20 + s[19] * t21 + s[20] * t22 + s[21] * t23 + s[22] * t24 + s[23] * t25;
+    float w33 = s[18] * t30 + s[19] * t31 + s[20] * t32 + s[21] * t33 + s[22] * t34 + s[23] * t35;
+    float w34 = s[18] * t40 + s[19] * t41 + s[20] * t42 + s[21] * t43 + s[22] * t44 + s[23] * t45;
+    float w35 = s[18] * t50 + s[19] * t51 + s[20] * t52 + s[21] * t53 + s[22] * t54 + s[23] * t55;
+    float w40 = s[24] * t00 + s[25] * t01 + s[26] * t02 + s[27] * t03 + s[28] * t04 + s[29] * t05;
+    float w41 = s[24] * t10 + s[25] * t11 + s[26] * t12 + s[27] * t13 + s[28] * t14 + s[29] * t15;
+    float w42 = s[24] * t20 + s[25] * t21 + s[26] * t22 + s[27] * t23 + s[28] * t24 + s[29] * t25;
+    float w43 = s[24] * t30 + s[25] * t31 + s[26] * t32 + s[27] * t33 + s[28] * t34 + s[29] * t35;
+    float w44 = s[24] * t40 + s[25] * t41 + s[26] * t42 + s[27] * t43 + s[28] * t44 + s[29] * t45;
+    float w45 = s[24] * t50 + s[25] * t51 + s[26] * t52 + s[27] * t53 + s[28] * t54 + s[29] * t55;
+    float w50 = s[30] * t00 + s[31] * t01 + s[32] * t02 + s[33] * t03 + s[34] * t04 + s[35] * t05;
+    float w51 = s[30] * t10 + s[31] * t11 + s[32] * t12 + s[33] * t13 + s[34] * t14 + s[35] * t15;
+    float w52 = s[30] * t20 + s[31] * t21 + s[32] * t22 + s[33] * t23 + s[34] * t24 + s[35] * t25;
+    float w53 = s[30] * t30 + s[31] * t31 + s[32] * t32 + s[33] * t33 + s[34] * t34 + s[35] * t35;
+    float w54 = s[30] * t40 + s[31] * t41 + s[32] * t42 + s[33] * t43 + s[34] * t44 + s[35] * t45;
+    float w55 = s[30] * t50 + s[31] * t51 + s[32] * t52 + s[33] * t53 + s[34] * t54 + s[35] * t55;
+
+    // S' = T W (upper triangle)
+    sampleCompliances[0][i] = t00 * w00 + t01 * w10 + t02 * w20 + t03 * w30 + t04 * w40 + t05 * w50;
+    sampleCompliances[1][i] = t00 * w01 + t01 * w11 + t02 * w21 + t03 * w31 + t04 * w41 + t05 * w51;
+    sampleCompliances[2][i] = t00 * w02 + t01 * w12 + t02 * w22 + t03 * w32 + t04 * w42 + t05 * w52;
+    sampleCompliances[3][i] = t00 * w03 + t01 * w13 + t02 * w23 + t03 * w33 + t04 * w43 + t05 * w53;
+    sampleCompliances[4][i] = t00 * w04 + t01 * w14 + t02 * w24 + t03 * w34 + t04 * w44 + t05 * w54;
+    sampleCompliances[5][i] = t00 * w05 + t01 * w15 + t02 * w25 + t03 * w35 + t04 * w45 + t05 * w55;
+    sampleCompliances[6][i] = t10 * w01 + t11 * w11 + t12 * w21 + t13 * w31 + t14 * w41 + t15 * w51;
+    sampleCompliances[7][i] = t10 * w02 + t11 * w12 + t12 * w22 + t13 * w32 + t14 * w42 + t15 * w52;
+    sampleCompliances[8][i] = t10 * w03 + t11 * w13 + t12 * w23 + t13 * w33 + t14 * w43 + t15 * w53;
+    sampleCompliances[9][i] = t10 * w04 + t11 * w14 + t12 * w24 + t13 * w34 + t14 * w44 + t15 * w54;
+    sampleCompliances[10][i] = t10 * w05 + t11 * w15 + t12 * w25 + t13 * w35 + t14 * w45 + t15 * w55;
+    sampleCompliances[11][i] = t20 * w02 + t21 * w12 + t22 * w22 + t23 * w32 + t24 * w42 + t25 * w52;
+    sampleCompliances[12][i] = t20 * w03 + t21 * w13 + t22 * w23 + t23 * w33 + t24 * w43 + t25 * w53;
+    sampleCompliances[13][i] = t20 * w04 + t21 * w14 + t22 * w24 + t23 * w34 + t24 * w44 + t25 * w54;
+    sampleCompliances[14][i] = t20 * w05 + t21 * w15 + t22 * w25 + t23 * w35 + t24 * w45 + t25 * w55;
+    sampleCompliances[15][i] = t30 * w03 + t31 * w13 + t32 * w23 + t33 * w33 + t34 * w43 + t35 * w53;
+    sampleCompliances[16][i] = t30 * w04 + t31 * w14 + t32 * w24 + t33 * w34 + t34 * w44 + t35 * w54;
+    sampleCompliances[17][i] = t30 * w05 + t31 * w15 + t32 * w25 + t33 * w35 + t34 * w45 + t35 * w55;
+    sampleCompliances[18][i] = t40 * w04 + t41 * w14 + t42 * w24 + t43 * w34 + t44 * w44 + t45 * w54;
+    sampleCompliances[19][i] = t40 * w05 + t41 * w15 + t42 * w25 + t43 * w35 + t44 * w45 + t45 * w55;
+    sampleCompliances[20][i] = t50 * w05 + t51 * w15 + t52 * w25 + t53 * w35 + t54 * w45 + t55 * w55;
+  }
+}
+
+/**
+ * @brief Computes the shear modulus and Poisson's ratio for a block of crystal frame loading / transverse direction pairs.
+ * With Voigt vectors u = (l1^2, l2^2, l3^2, l2 l3, l1 l3, l1 l2) of the loading direction l, v of the transverse
+ * direction t and r = (2 l1 t1, 2 l2 t2, 2 l3 t3, l2 t3 + l3 t2, l1 t3 + l3 t1, l1 t2 + l2 t1) the rotated compliances
+ * are s'11 = u^T S u, s'12 = u^T S v and s'66 = r^T S r, so that nu = -s'12 / s'11 and G = 1 / s'66.
+ * @param a x component of the loading direction in the crystal frame (unit length direction)
+ * @param b y component of the loading direction in the crystal frame
+ * @param c z component of the loading direction in the crystal frame
+ * @param d x component of the transverse direction in the crystal frame (unit length, perpendicular to the loading direction)
+ * @param e y component of the transverse direction in the crystal frame
+ * @param f z component of the transverse direction in the crystal frame
+ * @param count Number of directions (at most k_BlockSize)
+ * @param compliances 6x6 single crystal compliance matrix
+ * @param shearModuli Output: shear modulus in the plane of the loading and transverse directions
+ * @param poissonRatios Output: Poisson's ratio (transverse contraction under loading)
+ */
+inline void ShearModuliAndPoissonRatios(const float* a, const float* b, const float* c, const float* d, const float* e, const float* f, size_t count, const float* compliances,
+                                        float* shearModuli, float* poissonRatios)
+{
+  std::array<float, 36> s;
+  std::copy(compliances, compliances + 36, s.begin());
+
+  // Voigt vectors (component major so that each term below is one pass over the block, unused lanes stay 0)
+  std::array<std::array<float, k_BlockSize>, 6> u = {};
+  std::array<std::array<float, k_BlockSize>, 6> v = {};
+  std::array<std::array<float, k_BlockSize>, 6> r = {};
+  for(size_t i = 0; i < count; i++)
+  {
+    u[0][i] = a[i] * a[i];
+    u[1][i] = b[i] * b[i];
+    u[2][i] = c[i] * c[i];
+    u[3][i] = b[i] * c[i];
+    u[4][i] = a[i] * c[i];
+    u[5][i] = a[i] * b[i];
+    v[0][i] = d[i] * d[i];
+    v[1][i] = e[i] * e[i];
+    v[2][i] = f[i] * f[i];
+    v[3][i] = e[i] * f[i];
+    v[4][i] = d[i] * f[i];
+    v[5][i] = d[i] * e[i];
+    r[0][i] = 2.0f * a[i] * d[i];
+    r[1][i] = 2.0f * b[i] * e[i];
+    r[2][i] = 2.0f * c[i] * f[i];
+    r[3][i] = b[i] * f[i] + c[i] * e[i];
+    r[4][i] = a[i] * f[i] + c[i] * d[i];
+    r[5][i] = a[i] * e[i] + b[i] * d[i];
+  }
+
+  std::array<float, k_BlockSize> s11;
+  std::array<float, k_BlockSize> s12;
+  std::array<float, k_BlockSize> s66;
+  s11.fill(0.0f);
+  s12.fill(0.0f);
+  s66.fill(0.0f);
+  for(size_t I = 0; I < 6; I++)
+  {
+    for(size_t J = 0; J < 6; J++)
+    {
+      float sIJ = s[I * 6 + J];
+      for(size_t i = 0; i < k_BlockSize; i++)
+      {
+        s11[i] += sIJ * u[I][i] * u[J][i];
+        s12[i] += sIJ * u[I][i] * v[J][i];
+        s66[i] += sIJ * r[I][i] * r[J][i];
+      }
+    }
+  }
+
+  for(size_t i = 0; i < count; i++)
+  {
+    shearModuli[i] = 1.0f / s66[i];
+    poissonRatios[i] = -s12[i] / s11[i];
+  }
+}
+
+} // namespace DirectionalModulusKernels
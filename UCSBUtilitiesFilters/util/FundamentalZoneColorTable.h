@@ -0,0 +1,172 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                               *
+ * Copyright (c) 2015 The Regents of the University of California, Author: William Lenthe        *
+ *                                                                                               *
+ * This program is free software: you can redistribute it and/or modify it under the terms of    *
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either    *
+ * version 2 of the License, or (at your option) any later version.                              *
+ *                                                                                               *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;     *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.     *
+ * See the GNU Lesser General Public License for more details.                                   *
+ *                                                                                               *
+ * You should have received a copy of the GNU Lesser General Public License                      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.                         *
+ *                                                                                               *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "SIMPLib/Utilities/ColorTable.h"
+
+/**
+ * @brief The FundamentalZoneColorTable class samples a misorientation color map on a regular grid over a box of
+ * fundamental zone coordinates and interpolates it trilinearly. While the table is built every cell is checked against
+ * the map at a few points inside of it; cells where the interpolated color is off by more than the allowed error (e.g.
+ * where the map has a branch or a singularity) are not interpolated, lookup() then fails and the caller computes the
+ * color exactly.
+ */
+class FundamentalZoneColorTable
+{
+public:
+  using ColorFunction = SIMPL::Rgb (*)(double, double, double);
+
+  /**
+   * @brief Evaluates the color map on every node of the grid and checks every cell
+   * @param lower Lower corner of the box
+   * @param upper Upper corner of the box
+   * @param numIntervals Number of grid intervals along each axis
+   * @param maxError Largest difference per channel allowed at the check points of an interpolated cell
+   * @param color Color map to sample, must be defined over the whole box
+   */
+  FundamentalZoneColorTable(const std::array<double, 3>& lower, const std::array<double, 3>& upper, const std::array<size_t, 3>& numIntervals, int maxError, ColorFunction color)
+  : m_Lower(lower)
+  , m_Upper(upper)
+  , m_NumIntervals(numIntervals)
+  {
+    std::array<double, 3> spacing = {};
+    for(size_t d = 0; d < 3; d++)
+    {
+      spacing[d] = (m_Upper[d] - m_Lower[d]) / static_cast<double>(m_NumIntervals[d]);
+      m_Scale[d] = 1.0 / spacing[d];
+    }
+
+    m_Strides = {3, 3 * (m_NumIntervals[0] + 1), 3 * (m_NumIntervals[0] + 1) * (m_NumIntervals[1] + 1)};
+    m_Colors.resize(m_Strides[2] * (m_NumIntervals[2] + 1));
+    for(size_t k = 0; k <= m_NumIntervals[2]; k++)
+    {
+      for(size_t j = 0; j <= m_NumIntervals[1]; j++)
+      {
+        for(size_t i = 0; i <= m_NumIntervals[0]; i++)
+        {
+          SIMPL::Rgb rgb = color(m_Lower[0] + i * spacing[0], m_Lower[1] + j * spacing[1], m_Lower[2] + k * spacing[2]);
+          float* node = m_Colors.data() + i * m_Strides[0] + j * m_Strides[1] + k * m_Strides[2];
+          node[0] = static_cast<float>(RgbColor::dRed(rgb));
+          node[1] = static_cast<float>(RgbColor::dGreen(rgb));
+          node[2] = static_cast<float>(RgbColor::dBlue(rgb));
+        }
+      }
+    }
+
+    // check the center and the centers of the 8 octants of every cell
+    const std::array<float, 9> samplesX = {0.5f, 0.25f, 0.75f, 0.25f, 0.75f, 0.25f, 0.75f, 0.25f, 0.75f};
+    const std::array<float, 9> samplesY = {0.5f, 0.25f, 0.25f, 0.75f, 0.75f, 0.25f, 0.25f, 0.75f, 0.75f};
+    const std::array<float, 9> samplesZ = {0.5f, 0.25f, 0.25f, 0.25f, 0.25f, 0.75f, 0.75f, 0.75f, 0.75f};
+    m_ExactCells.resize(m_NumIntervals[0] * m_NumIntervals[1] * m_NumIntervals[2], 0);
+    for(size_t k = 0; k < m_NumIntervals[2]; k++)
+    {
+      for(size_t j = 0; j < m_NumIntervals[1]; j++)
+      {
+        for(size_t i = 0; i < m_NumIntervals[0]; i++)
+        {
+          uint8_t& exact = m_ExactCells[i + m_NumIntervals[0] * (j + m_NumIntervals[1] * k)];
+          for(size_t s = 0; s < samplesX.size() && 0 == exact; s++)
+          {
+            SIMPL::Rgb rgb = color(m_Lower[0] + (i + samplesX[s]) * spacing[0], m_Lower[1] + (j + samplesY[s]) * spacing[1], m_Lower[2] + (k + samplesZ[s]) * spacing[2]);
+            SIMPL::Rgb interpolated = interpolateCell(i, j, k, {samplesX[s], samplesY[s], samplesZ[s]});
+            int error = std::max({std::abs(RgbColor::dRed(rgb) - RgbColor::dRed(interpolated)), std::abs(RgbColor::dGreen(rgb) - RgbColor::dGreen(interpolated)),
+                                  std::abs(RgbColor::dBlue(rgb) - RgbColor::dBlue(interpolated))});
+            exact = error > maxError ? 1 : 0;
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Interpolates the color at a point
+   * @param x First coordinate
+   * @param y Second coordinate
+   * @param z Third coordinate
+   * @param rgb Output color
+   * @return false if the point is outside of the box or in a cell that has to be computed exactly
+   */
+  bool lookup(double x, double y, double z, SIMPL::Rgb& rgb) const
+  {
+    if(!(x >= m_Lower[0] && x <= m_Upper[0] && y >= m_Lower[1] && y <= m_Upper[1] && z >= m_Lower[2] && z <= m_Upper[2]))
+    {
+      return false;
+    }
+
+    std::array<double, 3> point = {x, y, z};
+    std::array<size_t, 3> cell = {};
+    std::array<float, 3> t = {};
+    for(size_t d = 0; d < 3; d++)
+    {
+      double u = (point[d] - m_Lower[d]) * m_Scale[d];
+      cell[d] = std::min(static_cast<size_t>(u), m_NumIntervals[d] - 1);
+      t[d] = static_cast<float>(u - static_cast<double>(cell[d]));
+    }
+    if(m_ExactCells[cell[0] + m_NumIntervals[0] * (cell[1] + m_NumIntervals[1] * cell[2])] != 0)
+    {
+      return false;
+    }
+    rgb = interpolateCell(cell[0], cell[1], cell[2], t);
+    return true;
+  }
+
+private:
+  std::array<double, 3> m_Lower;
+  std::array<double, 3> m_Upper;
+  std::array<size_t, 3> m_NumIntervals;
+  std::array<double, 3> m_Scale = {};
+  std::array<size_t, 3> m_Strides = {};
+  std::vector<float> m_Colors;
+  std::vector<uint8_t> m_ExactCells;
+
+  /**
+   * @brief Trilinear interpolation inside of a cell
+   * @param i, j, k Cell
+   * @param t Position inside of the cell (0 - 1)
+   */
+  SIMPL::Rgb interpolateCell(size_t i, size_t j, size_t k, const std::array<float, 3>& t) const
+  {
+    const float* c000 = m_Colors.data() + i * m_Strides[0] + j * m_Strides[1] + k * m_Strides[2];
+    const float* c100 = c000 + m_Strides[0];
+    const float* c010 = c000 + m_Strides[1];
+    const float* c110 = c010 + m_Strides[0];
+    const float* c001 = c000 + m_Strides[2];
+    const float* c101 = c001 + m_Strides[0];
+    const float* c011 = c001 + m_Strides[1];
+    const float* c111 = c011 + m_Strides[0];
+    std::array<int, 3> channels = {};
+    for(size_t c = 0; c < 3; c++)
+    {
+      float c00 = c000[c] + t[0] * (c100[c] - c000[c]);
+      float c10 = c010[c] + t[0] * (c110[c] - c010[c]);
+      float c01 = c001[c] + t[0] * (c101[c] - c001[c]);
+      float c11 = c011[c] + t[0] * (c111[c] - c011[c]);
+      float c0 = c00 + t[1] * (c10 - c00);
+      float c1 = c01 + t[1] * (c11 - c01);
+      channels[c] = static_cast<int>(c0 + t[2] * (c1 - c0) + 0.5f);
+    }
+    return RgbColor::dRgb(channels[0], channels[1], channels[2], 0);
+  }
+};
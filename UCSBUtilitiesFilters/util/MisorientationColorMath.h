@@ -0,0 +1,260 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                               *
+ * Copyright (c) 2015 The Regents of the University of California, Author: William Lenthe        *
+ *                                                                                               *
+ * This program is free software: you can redistribute it and/or modify it under the terms of    *
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either    *
+ * version 2 of the License, or (at your option) any later version.                              *
+ *                                                                                               *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;     *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.     *
+ * See the GNU Lesser General Public License for more details.                                   *
+ *                                                                                               *
+ * You should have received a copy of the GNU Lesser General Public License                      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.                         *
+ *                                                                                               *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * The misorientation color maps are written once against one of these math policies: ExactColorMath evaluates them in
+ * double precision with the standard library, FastColorMath in single precision with polynomial approximations that are
+ * accurate to a few float ulps, which is far below the resolution of 8 bit colors.
+ */
+
+/**
+ * @brief The ExactColorMath struct evaluates the color maps in double precision
+ */
+struct ExactColorMath
+{
+  using ValueType = double;
+
+  static double Sqrt(double x)
+  {
+    return sqrt(x);
+  }
+  static double Sin(double x)
+  {
+    return sin(x);
+  }
+  static double Cos(double x)
+  {
+    return cos(x);
+  }
+  static double Tan(double x)
+  {
+    return tan(x);
+  }
+  static double Acos(double x)
+  {
+    return acos(x);
+  }
+  static double Atan2(double y, double x)
+  {
+    return atan2(y, x);
+  }
+  static double Fmod(double x, double y)
+  {
+    return fmod(x, y);
+  }
+
+  /**
+   * @brief Returns the half rotation angle of the unit quaternion with vector part length n and scalar part w >= 0
+   */
+  static double HalfAngle(double n, double w)
+  {
+    (void)n;
+    return acos(std::min(w, 1.0));
+  }
+
+  /**
+   * @brief Returns true if a comparison of a and b that selects a branch of a color map may be decided differently than
+   * by the exact evaluation, never for the exact evaluation itself
+   */
+  static bool IsAmbiguous(double a, double b)
+  {
+    (void)a;
+    (void)b;
+    return false;
+  }
+
+  /**
+   * @brief Returns true if a rotation with vector part length n is too close to the identity, where the color maps are
+   * singular, to be colored like the exact evaluation, never for the exact evaluation itself
+   */
+  static bool IsNearIdentity(double n)
+  {
+    (void)n;
+    return false;
+  }
+};
+
+/**
+ * @brief The FastColorMath struct evaluates the color maps in single precision. The square root is the hardware
+ * instruction, atan2 and acos use the minimax polynomials of Abramowitz and Stegun (4.4.49 and 4.4.46, |error| <= 2e-8)
+ * and sin, cos and tan the Taylor polynomials on [-pi/4, pi/4] after reduction by multiples of pi/2.
+ */
+struct FastColorMath
+{
+  using ValueType = float;
+
+  static float Sqrt(float x)
+  {
+    return std::sqrt(x);
+  }
+
+  static float Sin(float x)
+  {
+    float r = 0.0f;
+    int quadrant = Reduce(x, r);
+    switch(quadrant & 3)
+    {
+    case 0:
+      return SinPoly(r);
+    case 1:
+      return CosPoly(r);
+    case 2:
+      return -SinPoly(r);
+    default:
+      return -CosPoly(r);
+    }
+  }
+
+  static float Cos(float x)
+  {
+    float r = 0.0f;
+    int quadrant = Reduce(x, r);
+    switch(quadrant & 3)
+    {
+    case 0:
+      return CosPoly(r);
+    case 1:
+      return -SinPoly(r);
+    case 2:
+      return -CosPoly(r);
+    default:
+      return SinPoly(r);
+    }
+  }
+
+  static float Tan(float x)
+  {
+    float r = 0.0f;
+    int quadrant = Reduce(x, r);
+    return (quadrant & 1) != 0 ? -CosPoly(r) / SinPoly(r) : SinPoly(r) / CosPoly(r);
+  }
+
+  static float Acos(float x)
+  {
+    float a = std::fabs(x);
+    a = a < 1.0f ? a : 1.0f;
+    float p = -0.0012624911f;
+    p = p * a + 0.0066700901f;
+    p = p * a - 0.0170881256f;
+    p = p * a + 0.0308918810f;
+    p = p * a - 0.0501743046f;
+    p = p * a + 0.0889789874f;
+    p = p * a - 0.2145988016f;
+    p = p * a + 1.5707963050f;
+    p *= std::sqrt(1.0f - a);
+    return x < 0.0f ? k_Pi - p : p;
+  }
+
+  static float Atan2(float y, float x)
+  {
+    float ax = std::fabs(x);
+    float ay = std::fabs(y);
+    float mx = ax > ay ? ax : ay;
+    if(mx == 0.0f)
+    {
+      return 0.0f;
+    }
+    float a = (ax > ay ? ay : ax) / mx;
+    float s = a * a;
+    float p = 0.0028662257f;
+    p = p * s - 0.0161657367f;
+    p = p * s + 0.0429096138f;
+    p = p * s - 0.0752896400f;
+    p = p * s + 0.1065626393f;
+    p = p * s - 0.1420889944f;
+    p = p * s + 0.1999355085f;
+    p = p * s - 0.3333314528f;
+    float angle = a + a * s * p;
+    angle = ay > ax ? k_HalfPi - angle : angle;
+    angle = x < 0.0f ? k_Pi - angle : angle;
+    return y < 0.0f ? -angle : angle;
+  }
+
+  static float Fmod(float x, float y)
+  {
+    return x - std::trunc(x / y) * y;
+  }
+
+  /**
+   * @brief Returns the half rotation angle of the unit quaternion with vector part length n and scalar part w >= 0, from
+   * both parts since acos(w) loses all precision of small rotations in single precision
+   */
+  static float HalfAngle(float n, float w)
+  {
+    return Atan2(n, w);
+  }
+
+  /**
+   * @brief Returns true if a and b are too close for the approximations to tell which one is larger
+   */
+  static bool IsAmbiguous(float a, float b)
+  {
+    return std::fabs(a - b) <= 1.0e-4f * (std::fabs(a) + std::fabs(b));
+  }
+
+  /**
+   * @brief Returns true for rotations below about 0.1 degrees, the exact evaluation rounds the angles of the smallest
+   * of them to 0
+   */
+  static bool IsNearIdentity(float n)
+  {
+    return n < 1.0e-3f;
+  }
+
+private:
+  static constexpr float k_Pi = 3.14159265358979323846f;
+  static constexpr float k_HalfPi = 1.57079632679489661923f;
+
+  /**
+   * @brief Reduces x to r in [-pi/4, pi/4] and returns the number of quarter turns, pi/2 is split in two parts so that
+   * the reduction is exact for the angles of the color maps (a few turns at most)
+   */
+  static int Reduce(float x, float& r)
+  {
+    float quadrant = std::nearbyint(x * 0.636619772367581343076f);
+    r = (x - quadrant * 1.5707963705062866211f) + quadrant * 4.3711388286737929e-8f;
+    return static_cast<int>(quadrant);
+  }
+
+  static float SinPoly(float r)
+  {
+    float s = r * r;
+    float p = -2.5052108385441718775e-8f;
+    p = p * s + 2.7557319223985890653e-6f;
+    p = p * s - 1.9841269841269841270e-4f;
+    p = p * s + 8.3333333333333333333e-3f;
+    p = p * s - 1.6666666666666666667e-1f;
+    return r + r * s * p;
+  }
+
+  static float CosPoly(float r)
+  {
+    float s = r * r;
+    float p = 2.0876756987868098979e-9f;
+    p = p * s - 2.7557319223985890653e-7f;
+    p = p * s + 2.4801587301587301587e-5f;
+    p = p * s - 1.3888888888888888889e-3f;
+    p = p * s + 4.1666666666666666667e-2f;
+    p = p * s - 0.5f;
+    return 1.0f + s * p;
+  }
+};